@@ -0,0 +1,306 @@
+# pragma once
+# include <Siv3D.hpp> // Siv3D v0.6.15
+# include <chrono>
+# include <functional>
+# include "SmallestEnclosingCircle.hpp"
+# include "Generator.hpp"
+
+
+
+//-----------------------------
+// データ構造の定義
+//-----------------------------
+
+
+
+/** ベンチマークの入力を生成する分布の中心。ヘッドレスでもウィンドウの設定によらず同じ入力になるよう、`Scene::CenterF()`ではなくその既定値に固定する。 */
+constexpr Vec2 BENCHMARK_CENTER{ 400, 300 };
+
+/** @brief `RunBenchmark`の設定 */
+struct BenchmarkConfig {
+    /** 計測の前に結果を捨てて実行する回数（キャッシュや分岐予測を温めるため） */
+    size_t warmup_iterations = 2;
+    /** 計測する実行回数 */
+    size_t measured_iterations = 21;
+    /** 1つの入力（分布・点数の組）の計測にかける時間の目安[s]。超えそうな場合は計測回数を減らす（最低1回）。 */
+    double max_seconds_per_input = 10.0;
+    /** 計測する点数の一覧 */
+    Array<size_t> sizes = { 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000 };
+    /** `BenchmarkStressDistributions`の各系統で計測する点数の一覧。最悪に近い入力は1回が長く、生成も重いので、既定では1e6点までにする。 */
+    Array<size_t> stress_sizes = { 100, 1'000, 10'000, 100'000, 1'000'000 };
+    /** `SmallestEnclosingCircle`に渡す許容誤差 */
+    double epsilon = 1e-8;
+    /** 入力の生成に使う乱数生成器の種。同じ種であれば同じ入力で計測される。 */
+    uint64 seed = 0;
+    /** 結果を書き出すCSVファイル */
+    FilePath csv_path = U"benchmark.csv";
+    /** 結果を書き出すJSONファイル */
+    FilePath json_path = U"benchmark.json";
+    /** 分布ごとにまとめた表を書き出すテキストファイル */
+    FilePath summary_path = U"benchmark-summary.txt";
+};
+
+/** @brief 1つの入力（分布・点数の組）に対する計測結果。時間の単位は秒。 */
+struct BenchmarkResult {
+    /** 入力の分布の名前 */
+    String distribution;
+    /** 点数 */
+    size_t n;
+    /** 計測した実行回数 */
+    size_t iterations;
+    double min_time;
+    double median_time;
+    /** 99パーセンタイル（最近傍順位法）。計測回数が100回未満の場合は最大値に近い値になる。 */
+    double p99_time;
+    /** 中央値から求めた1点あたりの時間[ns] */
+    double ns_per_point;
+    /** 中央値から求めた1秒あたりの処理点数 */
+    double points_per_second;
+    /** 計測の後に1回だけ、`SmallestEnclosingCircleStats`を取りながら実行した記録（計測した時間には含まれない） */
+    SmallestEnclosingCircleStats stats;
+};
+
+
+
+//-----------------------------
+// 主要関数の定義
+//-----------------------------
+
+
+
+/** @brief ベンチマークに使う入力の分布の一覧を返す。各要素は（名前, 点数と乱数生成器から点群を生成する関数）の組。 */
+Array<std::pair<String, std::function<Array<Vec2>(size_t, DefaultRNG&)>>> BenchmarkDistributions() {
+    return {
+        { U"normal",     [](size_t N, DefaultRNG& rng) { return GeneratePoints(static_cast<int32_t>(N), rng, BENCHMARK_CENTER); } },
+        { U"huge-large", [](size_t N, DefaultRNG& rng) { return GenerateHugeLarge(N, rng); } },
+        { U"huge-small", [](size_t N, DefaultRNG& rng) { return GenerateHugeSmall(N, rng, 1e8, 50000); } },
+        { U"spiral",     [](size_t N, DefaultRNG&) { return GenerateShuffled(N, BENCHMARK_CENTER); } },
+    };
+}
+
+/**
+ * @brief 最悪に近い場合を狙った`StressFamilies`の各系統を、`BenchmarkDistributions`と同じ形で返す。名前は`StressFamilies`と同じ。
+ * 点数は`BenchmarkConfig::sizes`ではなく`BenchmarkConfig::stress_sizes`から取る。
+ */
+Array<std::pair<String, std::function<Array<Vec2>(size_t, DefaultRNG&)>>> BenchmarkStressDistributions() {
+    Array<std::pair<String, std::function<Array<Vec2>(size_t, DefaultRNG&)>>> distributions;
+    for (const auto& family : StressFamilies()) {
+        const auto generate = family.second;
+        distributions.emplace_back(family.first, [=](size_t N, DefaultRNG& rng) { return generate(N, rng, BENCHMARK_CENTER); });
+    }
+    return distributions;
+}
+
+/** @brief 昇順に並んだ`sorted`の`q`分位点（0 < q <= 1）を最近傍順位法で返す。 */
+double Percentile(const Array<double>& sorted, const double q) {
+    const size_t rank = static_cast<size_t>(std::ceil(q * sorted.size()));
+    return sorted[Clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+/** @brief 3次元のベンチマークに使う入力の分布の一覧を返す。各要素は（名前, 点数と乱数生成器から点群を生成する関数）の組。 */
+Array<std::pair<String, std::function<Array<Vec3>(size_t, DefaultRNG&)>>> BenchmarkDistributions3D() {
+    return {
+        { U"normal-3d",     [](size_t N, DefaultRNG& rng) { return GeneratePoints3D(N, rng, 100.0); } },
+        { U"huge-large-3d", [](size_t N, DefaultRNG& rng) { return GeneratePoints3D(N, rng, 1e17); } },
+    };
+}
+
+/**
+ * @brief `solve`の実行時間を、`config`に従って繰り返し計測し、昇順に並べて返す。
+ * @param solve 1回解いて、結果の半径を返す関数。結果を使わないと計算ごと省かれうるので、半径の和を`checksum`に足しておく。
+ */
+Array<double> MeasureTimes(const std::function<double()>& solve, const BenchmarkConfig& config, double& checksum) {
+    const auto run_once = [&]() {
+        const auto start = std::chrono::steady_clock::now();
+        checksum += solve();
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(end - start).count();
+    };
+
+    double warmup_time = 0;
+    for (size_t i = 0; i < config.warmup_iterations; i++) {
+        warmup_time = run_once();
+    }
+    if (config.warmup_iterations == 0) {
+        warmup_time = run_once();
+    }
+
+    // 大きな入力では、1入力あたりの時間の目安を超えないよう計測回数を減らす。
+    const size_t iterations = Clamp<size_t>(
+        static_cast<size_t>(config.max_seconds_per_input / Max(warmup_time, 1e-9)),
+        1,
+        Max<size_t>(config.measured_iterations, 1)
+    );
+    Array<double> times(iterations);
+    for (auto& time : times) {
+        time = run_once();
+    }
+    std::ranges::sort(times);
+    return times;
+}
+
+/** @brief 点群`points`に対する`SmallestEnclosingCircle`の実行時間を、`config`に従って繰り返し計測する。 */
+BenchmarkResult MeasureSmallestEnclosing(const String& distribution, const Array<Vec2>& points, const BenchmarkConfig& config) {
+    // 結果を使わないと計算ごと省かれうるので、半径の和を最後に出力しておく。
+    double checksum = 0;
+    const Array<double> times = MeasureTimes([&]() { return SmallestEnclosingCircle(points, config.epsilon).r; }, config, checksum);
+
+    // 記録の処理が時間に影響しないよう、記録は計測とは別の実行で取る。
+    SmallestEnclosingCircleStats stats;
+    checksum += SmallestEnclosingCircle(points, stats, config.epsilon).r;
+
+    const size_t n = points.size();
+    const double median_time = Percentile(times, 0.5);
+    Console << U"  [{}] N = {}: median {:.9f}s, rebuilds ({}, {}, {}) (checksum: {})"_fmt(
+        distribution, n, median_time, stats.outerRebuilds, stats.middleRebuilds, stats.innerRebuilds, checksum);
+    return BenchmarkResult{
+        distribution,
+        n,
+        times.size(),
+        times.front(),
+        median_time,
+        Percentile(times, 0.99),
+        (median_time * 1e9 / n),
+        (n / median_time),
+        stats,
+    };
+}
+
+/** @brief 3次元の点群`points`に対する`SmallestEnclosingSphere`の実行時間を、`config`に従って繰り返し計測する。`stats`は記録しない（全て0）。 */
+BenchmarkResult MeasureSmallestEnclosingSphere(const String& distribution, const Array<Vec3>& points, const BenchmarkConfig& config) {
+    double checksum = 0;
+    const Array<double> times = MeasureTimes([&]() { return SmallestEnclosingSphere(points, config.epsilon).r; }, config, checksum);
+
+    const size_t n = points.size();
+    const double median_time = Percentile(times, 0.5);
+    Console << U"  [{}] N = {}: median {:.9f}s (checksum: {})"_fmt(distribution, n, median_time, checksum);
+    return BenchmarkResult{
+        distribution,
+        n,
+        times.size(),
+        times.front(),
+        median_time,
+        Percentile(times, 0.99),
+        (median_time * 1e9 / n),
+        (n / median_time),
+        SmallestEnclosingCircleStats{},
+    };
+}
+
+/** @brief 計測結果`results`をCSV形式で`filepath`に書き出す。 */
+void WriteBenchmarkCSV(const Array<BenchmarkResult>& results, const FilePath& filepath) {
+    TextWriter writer{filepath};
+    writer << U"distribution,n,iterations,min_s,median_s,p99_s,ns_per_point,points_per_second,outer_rebuilds,middle_rebuilds,inner_rebuilds,contains_tests,shuffle_s";
+    for (const auto& result : results) {
+        writer << U"{},{},{},{:.9f},{:.9f},{:.9f},{:.3f},{:.0f},{},{},{},{},{:.9f}"_fmt(
+            result.distribution, result.n, result.iterations,
+            result.min_time, result.median_time, result.p99_time,
+            result.ns_per_point, result.points_per_second,
+            result.stats.outerRebuilds, result.stats.middleRebuilds, result.stats.innerRebuilds,
+            result.stats.containsTests, result.stats.shuffleSeconds);
+    }
+}
+
+/** @brief 計測結果`results`と計測条件`config`をJSON形式で`filepath`に書き出す。 */
+void WriteBenchmarkJSON(const Array<BenchmarkResult>& results, const BenchmarkConfig& config, const FilePath& filepath) {
+    TextWriter writer{filepath};
+    writer << U"{";
+    writer << U"  \"date\": \"{}\","_fmt(DateTime::Now());
+    writer << U"  \"warmup_iterations\": {},"_fmt(config.warmup_iterations);
+    writer << U"  \"measured_iterations\": {},"_fmt(config.measured_iterations);
+    writer << U"  \"epsilon\": {},"_fmt(config.epsilon);
+    writer << U"  \"seed\": {},"_fmt(config.seed);
+    writer << U"  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& result = results[i];
+        writer << U"    {{ \"distribution\": \"{}\", \"n\": {}, \"iterations\": {}, \"min_s\": {:.9f}, \"median_s\": {:.9f}, \"p99_s\": {:.9f}, \"ns_per_point\": {:.3f}, \"points_per_second\": {:.0f}, "_fmt(
+            result.distribution, result.n, result.iterations,
+            result.min_time, result.median_time, result.p99_time,
+            result.ns_per_point, result.points_per_second)
+            + U"\"stats\": {{ \"outer_rebuilds\": {}, \"middle_rebuilds\": {}, \"inner_rebuilds\": {}, \"contains_tests\": {}, \"shuffle_s\": {:.9f} }} }}{}"_fmt(
+            result.stats.outerRebuilds, result.stats.middleRebuilds, result.stats.innerRebuilds,
+            result.stats.containsTests, result.stats.shuffleSeconds,
+            (i + 1 < results.size()) ? U"," : U"");
+    }
+    writer << U"  ]";
+    writer << U"}";
+}
+
+/**
+ * @brief 計測結果`results`を分布ごとにまとめた表を`filepath`とコンソールに書き出す。
+ * 各分布について、最小と最大の点数での1点あたりの時間[ns]とその比、最大の点数での1点あたりの円の作り直しの回数（外側・中間・内側）を並べる。
+ * 比が1より大きく離れる分布や、作り直しの回数が点数とともに増える分布が、期待線形時間から外れている分布である。
+ */
+void WriteBenchmarkSummary(const Array<BenchmarkResult>& results, const FilePath& filepath) {
+    TextWriter writer{filepath};
+    const auto write_line = [&](const String& line) {
+        writer << line;
+        Console << line;
+    };
+    write_line(U"{:<16} {:>10} {:>14} {:>10} {:>14} {:>8} {:>12} {:>12} {:>12}"_fmt(
+        U"distribution", U"min N", U"ns/point", U"max N", U"ns/point", U"ratio", U"outer/N", U"middle/N", U"inner/N"));
+    Array<String> distributions;
+    for (const auto& result : results) {
+        if (not distributions.contains(result.distribution)) { distributions << result.distribution; }
+    }
+    for (const auto& distribution : distributions) {
+        const BenchmarkResult* smallest = nullptr;
+        const BenchmarkResult* largest = nullptr;
+        for (const auto& result : results) {
+            if (result.distribution != distribution) { continue; }
+            if ((not smallest) or (result.n < smallest->n)) { smallest = &result; }
+            if ((not largest) or (result.n > largest->n)) { largest = &result; }
+        }
+        const double n = static_cast<double>(largest->n);
+        write_line(U"{:<16} {:>10} {:>14.3f} {:>10} {:>14.3f} {:>8.3f} {:>12.6f} {:>12.6f} {:>12.6f}"_fmt(
+            distribution,
+            smallest->n, smallest->ns_per_point,
+            largest->n, largest->ns_per_point,
+            (largest->ns_per_point / smallest->ns_per_point),
+            (largest->stats.outerRebuilds / n), (largest->stats.middleRebuilds / n), (largest->stats.innerRebuilds / n)));
+    }
+}
+
+/**
+ * @brief `SmallestEnclosingCircle`の実行時間を、分布と点数を変えながら計測する。
+ *
+ * 1. `BenchmarkDistributions`（3次元の`SmallestEnclosingSphere`は`BenchmarkDistributions3D`）の各分布について`config.sizes`の各点数の、
+ *    `BenchmarkStressDistributions`の各系統について`config.stress_sizes`の各点数の点群を生成し、
+ *
+ * 2. `config.warmup_iterations`回の空実行の後、`config.measured_iterations`回の実行時間を計測して、
+ *
+ * 3. 最小値・中央値・99パーセンタイル、1点あたりの時間、1秒あたりの処理点数と、別の1回の実行で取った`SmallestEnclosingCircleStats`を`config.csv_path`, `config.json_path`に書き出し、
+ *
+ * 4. 分布ごとの1点あたりの時間と円の作り直しの回数の表を`config.summary_path`に書き出す（`WriteBenchmarkSummary`）。
+ *
+ * ウィンドウを使わないので、`Main.cpp`ではヘッドレスで起動する。
+ */
+void RunBenchmark(const BenchmarkConfig& config = {}) {
+    Console << U"[Benchmark at {}]"_fmt(DateTime::Now());
+    Array<BenchmarkResult> results;
+    const auto measure_all = [&](const auto& distributions, const Array<size_t>& sizes) {
+        for (const auto& [name, generate] : distributions) {
+            // 分布ごとに同じ種から生成し、分布の追加や並べ替えで他の分布の入力が変わらないようにする。
+            DefaultRNG rng;
+            rng.seed(config.seed);
+            for (const size_t n : sizes) {
+                const Array<Vec2> points = generate(n, rng);
+                results << MeasureSmallestEnclosing(name, points, config);
+            }
+        }
+    };
+    measure_all(BenchmarkDistributions(), config.sizes);
+    measure_all(BenchmarkStressDistributions(), config.stress_sizes);
+    for (const auto& [name, generate] : BenchmarkDistributions3D()) {
+        DefaultRNG rng;
+        rng.seed(config.seed);
+        for (const size_t n : config.sizes) {
+            const Array<Vec3> points = generate(n, rng);
+            results << MeasureSmallestEnclosingSphere(name, points, config);
+        }
+    }
+    WriteBenchmarkCSV(results, config.csv_path);
+    WriteBenchmarkJSON(results, config, config.json_path);
+    WriteBenchmarkSummary(results, config.summary_path);
+    Console << U"wrote in {}, {}, {}"_fmt(config.csv_path, config.json_path, config.summary_path);
+}
@@ -1,45 +1,96 @@
 #pragma once
 #include <Siv3D.hpp>
+#include <atomic>
+#include <charconv>
+#include <cstdio>
 #include <fstream>
+#include <functional>
+#include <thread>
 
 using Points = Array<Vec2>;
 
-NormalDistribution<double> StandardDistribution() {
-    const Vec2 center_f = Scene::CenterF();
+NormalDistribution<double> StandardDistribution(const Vec2& center_f) {
     return NormalDistribution<double>{center_f.x, center_f.x / 4};
 }
 
-void WriteInputToFile(const FilePath& filepath, const Array<Vec2>& points) {
-    std::ofstream fout{filepath.toUTF8()};
-    // #FIXED: Assertion failed: (fout), function WriteInputToFile, file Generator.hpp, line 24.
-    assert(fout);
-    fout << points.size() << "\n";
-    fout << std::setprecision(16);
-    for (int32_t i = 0; i < points.size(); i++) {
-        fout << points[i].x << " " << points[i].y << "\n";
+NormalDistribution<double> StandardDistribution() {
+    return StandardDistribution(Scene::CenterF());
+}
+
+/**
+ * @brief 点群`points`をテキスト形式（1行目に点数N、続くN行に"x y"）で`filepath`に書き出す。書き出せた場合に限り`true`を返す。
+ * 座標は`std::setprecision(16)`で`<<`した場合と同じ文字列（printfの`%.16g`）になる。ストリームの書式処理を通さないので、大きな点群でも速い。
+ */
+bool WritePointsAsText(const FilePath& filepath, const Array<Vec2>& points) {
+    std::ofstream fout{filepath.toUTF8(), std::ios::binary};
+    if (not fout) { return false; }
+
+    std::string buffer = std::to_string(points.size()) + "\n";
+    const auto append = [&](const double value) {
+        char text[32];
+    #if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+        const char* const end = std::to_chars(text, text + sizeof(text), value, std::chars_format::general, 16).ptr;
+    #else
+        const char* const end = text + std::snprintf(text, sizeof(text), "%.16g", value);
+    #endif
+        buffer.append(text, static_cast<size_t>(end - text));
+    };
+    for (const Vec2& point : points) {
+        append(point.x);
+        buffer += ' ';
+        append(point.y);
+        buffer += '\n';
+        // 大きな点群で全体を文字列にしないよう、ある程度たまったら書き出す。
+        if (buffer.size() >= (1 << 20)) {
+            fout.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
     }
-    fout << std::flush;
-    Console << U"wrote in {}"_fmt(filepath);
+    fout.write(buffer.data(), buffer.size());
+    return static_cast<bool>(fout.flush());
+}
+
+/** @brief 点群`points`を`WritePointsAsText`で`filepath`に書き出し、その結果をコンソールに出力する。書き出せた場合に限り`true`を返す。 */
+bool WriteInputToFile(const FilePath& filepath, const Array<Vec2>& points) {
+    // #FIXED: Assertion failed: (fout), function WriteInputToFile, file Generator.hpp, line 24.
+    const bool written = WritePointsAsText(filepath, points);
+    Console << (written ? U"wrote in {}"_fmt(filepath) : U"failed to write {}"_fmt(filepath));
+    return written;
 }
 
 /**
- * @brief `N`点のランダムな点を生成して返す。
+ * @brief `N`点のランダムな点を、`center_f`を中心とする正規分布に従って生成して返す。
  * 
  * @param rng 乱数生成器
+ * @param center_f 分布の中心。`Scene::CenterF()`はメインスレッド以外から呼ばないよう、呼び出し側で求めて渡す。
  * @return Array<Vec2> 生成された点群
  */
 Points GeneratePoints(
     const int32_t N,
-    DefaultRNG& rng
+    DefaultRNG& rng,
+    const Vec2& center_f
 ) {
     Points points;
-    auto dist = StandardDistribution();
+    auto dist = StandardDistribution(center_f);
     for (int32_t i = 0; i < N; i++) {
         points.emplace_back(dist(rng), dist(rng));
     }
     return points;
 }
 
+/**
+ * @brief `N`点のランダムな点を生成して返す。
+ * 
+ * @param rng 乱数生成器
+ * @return Array<Vec2> 生成された点群
+ */
+Points GeneratePoints(
+    const int32_t N,
+    DefaultRNG& rng
+) {
+    return GeneratePoints(N, rng, Scene::CenterF());
+}
+
 Array<Vec2> GenerateHugeSmall(size_t N, DefaultRNG& rng, double average, double variance) {
     Array<Vec2> points(N);
     NormalDistribution<double> dist{average, variance};
@@ -57,30 +108,218 @@ Array<Vec2> GenerateHugeLarge(size_t N, DefaultRNG& rng) {
     return points;
 }
 
-Array<Vec2> GenerateShuffled(size_t N) {
+/** @brief `N`点の3次元のランダムな点を、原点を中心とし各座標の標準偏差が`stddev`の正規分布に従って生成して返す。 */
+Array<Vec3> GeneratePoints3D(size_t N, DefaultRNG& rng, double stddev = 1.0) {
+    Array<Vec3> points(N);
+    NormalDistribution<double> dist{0, stddev};
+    for (size_t i = 0; i < N; i++) {
+        points[i] = {dist(rng), dist(rng), dist(rng)};
+    }
+    return points;
+}
+
+Array<Vec2> GenerateShuffled(size_t N, const Vec2& center_f) {
     Array<Vec2> points(N);
-    for (int32 i = 0; i < N; ++i)
+    for (size_t i = 0; i < N; ++i)
     {
-        points[i] = OffsetCircular{ Scene::CenterF(), (200.0 * i / N), (120_deg * i) };
+        points[i] = OffsetCircular{ center_f, (200.0 * i / N), (120_deg * i) };
     }
     return points;
 }
 
-void GenerateLargeInputs() {
-    DefaultRNG rng = GetDefaultRNG();
-    const uint64 seed = 0;
-    rng.seed(seed);
-    auto tofullpath = [&](const String& filestem){ return U"input-auto/{}.txt"_fmt(filestem); };
-    for (int32_t i = 0; i < 30; i++) {
-        WriteInputToFile(tofullpath(U"huge-large-{}"_fmt(i)), GenerateHugeLarge(300, rng));
-        WriteInputToFile(tofullpath(U"huge-small-{}"_fmt(i)), GenerateHugeSmall(1000, rng, 1e8, 50000));
-        WriteInputToFile(tofullpath(U"huge-super-small-{}"_fmt(i)), GenerateHugeSmall(1000, rng, 1e6, 200));
+Array<Vec2> GenerateShuffled(size_t N) {
+    return GenerateShuffled(N, Scene::CenterF());
+}
+
+/** @brief `N`点を、`center`を中心とする半径`radius`の円周上に一様な角度で生成して返す。全ての点が最小包含円の境界上に乗る。 */
+Array<Vec2> GenerateOnCircle(size_t N, DefaultRNG& rng, const Vec2& center, double radius) {
+    Array<Vec2> points(N);
+    UniformDistribution<double> angle{0, Math::TwoPi};
+    for (size_t i = 0; i < N; i++) {
+        points[i] = OffsetCircular{ center, radius, angle(rng) };
     }
-    WriteInputToFile(tofullpath(U"shuffled"),   GenerateShuffled(300));
-    for (int32_t i = 0; i < 100; i++) {
-        WriteInputToFile(tofullpath(U"many-1e4-{}"_fmt(i)), GeneratePoints(1e4, rng));
+    return points;
+}
+
+/** @brief `N`点を、`center`を中心とする半径`radius`の円周の近くに、半径方向へ相対的に±`jitter`だけずらして生成して返す。 */
+Array<Vec2> GenerateNearCocircular(size_t N, DefaultRNG& rng, const Vec2& center, double radius, double jitter) {
+    Array<Vec2> points(N);
+    UniformDistribution<double> angle{0, Math::TwoPi};
+    UniformDistribution<double> scale{1 - jitter, 1 + jitter};
+    for (size_t i = 0; i < N; i++) {
+        points[i] = OffsetCircular{ center, (radius * scale(rng)), angle(rng) };
     }
-    for (int32_t i = 0; i < 100; i++) {
-        WriteInputToFile(tofullpath(U"many-1e5-{}"_fmt(i)), GeneratePoints(1e5, rng));
+    return points;
+}
+
+/** @brief 点群`points`を、`center`から見た偏角の昇順に並べ替えて返す。 */
+Array<Vec2> SortedByAngle(Array<Vec2> points, const Vec2& center) {
+    std::ranges::sort(points, {}, [&](const Vec2& p) { return std::atan2(p.y - center.y, p.x - center.x); });
+    return points;
+}
+
+/** @brief 点群`points`を、`center`からの距離の昇順に並べ替えて返す。シャッフルせずに1点ずつ取り込むと、毎回円を作り直すことになる並びである。 */
+Array<Vec2> SortedByRadius(Array<Vec2> points, const Vec2& center) {
+    std::ranges::sort(points, {}, [&](const Vec2& p) { return p.distanceFromSq(center); });
+    return points;
+}
+
+/** @brief `center`を中心とする標準偏差`stddev`の正規分布から`distinct_count`点を選び、その中から重複を許して`N`点を取り出して返す。 */
+Array<Vec2> GenerateHeavyDuplicates(size_t N, DefaultRNG& rng, const Vec2& center, double stddev, size_t distinct_count) {
+    Array<Vec2> distinct(Max<size_t>(distinct_count, 1));
+    NormalDistribution<double> dist_x{center.x, stddev};
+    NormalDistribution<double> dist_y{center.y, stddev};
+    for (auto& point : distinct) {
+        point = { dist_x(rng), dist_y(rng) };
+    }
+    Array<Vec2> points(N);
+    UniformIntDistribution<size_t> pick{0, distinct.size() - 1};
+    for (size_t i = 0; i < N; i++) {
+        points[i] = distinct[pick(rng)];
+    }
+    return points;
+}
+
+/**
+ * @brief 原点から`offset`だけ離れた位置の周りに`cluster_count`個の小さな塊を作り、`N`点を生成して返す。
+ * 塊の中心は`offset`の周りに標準偏差`spread * 100`で、各塊の点はその中心の周りに標準偏差`spread`で散らばる。
+ * 座標の大きさに比べて円が小さいので、桁落ちが起きやすい。
+ */
+Array<Vec2> GenerateFarClusters(size_t N, DefaultRNG& rng, const Vec2& offset, double spread, size_t cluster_count) {
+    Array<Vec2> centers(Max<size_t>(cluster_count, 1));
+    NormalDistribution<double> center_dist{0, spread * 100};
+    for (auto& center : centers) {
+        center = offset + Vec2{ center_dist(rng), center_dist(rng) };
+    }
+    Array<Vec2> points(N);
+    NormalDistribution<double> dist{0, spread};
+    UniformIntDistribution<size_t> pick{0, centers.size() - 1};
+    for (size_t i = 0; i < N; i++) {
+        points[i] = centers[pick(rng)] + Vec2{ dist(rng), dist(rng) };
+    }
+    return points;
+}
+
+/**
+ * @brief 最悪に近い場合を狙った入力の系統の一覧を返す。各要素は（名前, 点数・乱数生成器・分布の中心から点群を生成する関数）の組。
+ * `GenerateLargeInputs`の`input-auto`と`BenchmarkStressDistributions`で共通して使う。
+ */
+Array<std::pair<String, std::function<Array<Vec2>(size_t, DefaultRNG&, const Vec2&)>>> StressFamilies() {
+    return {
+        { U"on-circle",       [](size_t N, DefaultRNG& rng, const Vec2& c) { return GenerateOnCircle(N, rng, c, c.x / 2); } },
+        { U"near-cocircular", [](size_t N, DefaultRNG& rng, const Vec2& c) { return GenerateNearCocircular(N, rng, c, c.x / 2, 1e-6); } },
+        { U"sorted-angle",    [](size_t N, DefaultRNG& rng, const Vec2& c) { return SortedByAngle(GenerateNearCocircular(N, rng, c, c.x / 2, 1e-3), c); } },
+        { U"sorted-radius",   [](size_t N, DefaultRNG& rng, const Vec2& c) { return SortedByRadius(GeneratePoints(static_cast<int32_t>(N), rng, c), c); } },
+        { U"duplicates",      [](size_t N, DefaultRNG& rng, const Vec2& c) { return GenerateHeavyDuplicates(N, rng, c, c.x / 4, 16); } },
+        { U"far-clusters",    [](size_t N, DefaultRNG& rng, const Vec2&)   { return GenerateFarClusters(N, rng, Vec2{ 1e9, -1e9 }, 1.0, 8); } },
+    };
+}
+
+/** @brief `GenerateLargeInputs`の設定 */
+struct GeneratorConfig {
+    /** 主となる乱数の種。各ファイルの種は、これとファイル名から`DeriveSeed`で求める。 */
+    uint64 seed = 0;
+    /** 生成と書き出しに使うスレッド数。0の場合は`Threading::GetConcurrency()`の値を使う。出力はスレッド数によらない。 */
+    size_t thread_count = 0;
+    /** `huge-large-*`, `huge-small-*`, `huge-super-small-*`をそれぞれ何ファイル生成するか */
+    size_t huge_file_count = 30;
+    /** `many-*`の各点数について何ファイル生成するか */
+    size_t many_file_count = 100;
+    /** `many-*`の点数の一覧（1ファイルあたり1e7点程度まで）。10の累乗であればファイル名は`many-1e5-0`のようになる。 */
+    Array<size_t> many_sizes = { 10'000, 100'000 };
+    /** `StressFamilies`の各系統・`stress_sizes`の各点数について何ファイル生成するか */
+    size_t stress_file_count = 5;
+    /** `StressFamilies`の点数の一覧。ファイル名は`on-circle-1e3-0`のようになる。 */
+    Array<size_t> stress_sizes = { 1'000, 100'000 };
+    /**
+     * `StressFamilies`の各系統について1ファイルずつ生成する大規模な点数の一覧。
+     * 1e6点でも1ファイル40MB程度になり、`FullTest`の時間の大半を占めるので、既定では生成しない（`{ 1'000'000 }`などを指定して使う）。
+     */
+    Array<size_t> stress_large_sizes = {};
+    /** 出力先のディレクトリ */
+    FilePath directory = U"input-auto";
+};
+
+/**
+ * @brief 主となる種`seed`とファイル名`filestem`から、そのファイル専用の乱数の種を求める。
+ * ファイル名のFNV-1aハッシュ値と`seed`を混ぜ、SplitMix64の出力関数で攪拌する。
+ * これにより、1ファイルだけを生成し直したり、ファイルを追加したりしても、他のファイルの内容は変わらない。
+ */
+uint64 DeriveSeed(const uint64 seed, const String& filestem) {
+    uint64 hash = 14695981039346656037ull;
+    for (const char32 c : filestem) {
+        hash = (hash ^ c) * 1099511628211ull;
+    }
+    uint64 z = (seed ^ hash) + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/** @brief 点数`N`をファイル名に使う文字列にする。10の累乗であれば`1e5`のように、それ以外は`12345`のように表す。 */
+String SizeToFileStem(size_t N) {
+    size_t exponent = 0;
+    for (size_t n = N; (n >= 10) and (n % 10 == 0); n /= 10) { exponent++; }
+    const bool power_of_ten = (N != 0) and (N == static_cast<size_t>(std::pow(10.0, exponent)) );
+    return power_of_ten ? U"1e{}"_fmt(exponent) : U"{}"_fmt(N);
+}
+
+void GenerateLargeInputs(const GeneratorConfig& config = {}) {
+    // 各ファイルは (ファイル名, ファイル専用の乱数生成器から点群を生成する関数) で表す。
+    // Scene::CenterF() はワーカースレッドから呼ばないよう、ここで求めておく。
+    const Vec2 center_f = Scene::CenterF();
+    Array<std::pair<String, std::function<Array<Vec2>(DefaultRNG&)>>> files;
+    for (size_t i = 0; i < config.huge_file_count; i++) {
+        files.emplace_back(U"huge-large-{}"_fmt(i), [](DefaultRNG& rng) { return GenerateHugeLarge(300, rng); });
+        files.emplace_back(U"huge-small-{}"_fmt(i), [](DefaultRNG& rng) { return GenerateHugeSmall(1000, rng, 1e8, 50000); });
+        files.emplace_back(U"huge-super-small-{}"_fmt(i), [](DefaultRNG& rng) { return GenerateHugeSmall(1000, rng, 1e6, 200); });
+    }
+    files.emplace_back(U"shuffled", [=](DefaultRNG&) { return GenerateShuffled(300, center_f); });
+    for (const size_t N : config.many_sizes) {
+        for (size_t i = 0; i < config.many_file_count; i++) {
+            files.emplace_back(U"many-{}-{}"_fmt(SizeToFileStem(N), i), [=](DefaultRNG& rng) { return GeneratePoints(static_cast<int32_t>(N), rng, center_f); });
+        }
     }
-}
\ No newline at end of file
+    // 構造化束縛はラムダ式で捕捉できない処理系があるので、生成関数はコピーしてから捕捉する。
+    for (const auto& family : StressFamilies()) {
+        const auto generate = family.second;
+        for (const size_t N : config.stress_sizes) {
+            for (size_t i = 0; i < config.stress_file_count; i++) {
+                files.emplace_back(U"{}-{}-{}"_fmt(family.first, SizeToFileStem(N), i), [=](DefaultRNG& rng) { return generate(N, rng, center_f); });
+            }
+        }
+    }
+    for (const auto& family : StressFamilies()) {
+        const auto generate = family.second;
+        for (const size_t N : config.stress_large_sizes) {
+            files.emplace_back(U"{}-{}"_fmt(family.first, SizeToFileStem(N)), [=](DefaultRNG& rng) { return generate(N, rng, center_f); });
+        }
+    }
+
+    // 点数の多いファイルほど概ね後ろにあるので、後ろから取り出して大きい仕事から先に片付ける。
+    const size_t thread_count = Clamp<size_t>((config.thread_count == 0) ? Threading::GetConcurrency() : config.thread_count, 1, files.size());
+    std::atomic<size_t> next{0};
+    // Array<bool> はビット単位で詰められることがあり、別々の要素への同時書き込みが競合しうるので uint8 で持つ。
+    Array<uint8> written(files.size(), 0);
+    const auto worker = [&]() {
+        for (size_t k = next++; k < files.size(); k = next++) {
+            const size_t index = (files.size() - 1 - k);
+            const auto& [filestem, generate] = files[index];
+            DefaultRNG rng;
+            rng.seed(DeriveSeed(config.seed, filestem));
+            written[index] = WritePointsAsText(U"{}/{}.txt"_fmt(config.directory, filestem), generate(rng));
+        }
+    };
+    Array<std::thread> threads;
+    for (size_t t = 1; t < thread_count; t++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < files.size(); i++) {
+        Console << U"{} {}/{}.txt"_fmt(written[i] ? U"wrote in" : U"failed to write", config.directory, files[i].first);
+    }
+}
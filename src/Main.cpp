@@ -2,16 +2,21 @@
 #include "SmallestEnclosingCircle.hpp"
 #include "Tester.hpp"
 #include "Generator.hpp"
+#include "Benchmark.hpp"
 
 enum class ApplicationMode {
     GenerateAndTest,
     FullTest,
     RandomTest,
-    GenerateInput
+    GenerateInput,
+    ConvertInputs,
+    Benchmark
 };
 constexpr ApplicationMode mode = ApplicationMode::GenerateAndTest;
 // Modify this line to change the behavior of this application.
 constexpr double EPSILON = 1e-8;
+// The benchmark only writes to the console and files, so it runs without a window.
+SIV3D_SET(mode == ApplicationMode::Benchmark ? EngineOption::Renderer::Headless : EngineOption::Renderer::PlatformDefault);
 
 void Main() {
     switch (mode) {
@@ -28,5 +33,11 @@ void Main() {
         case ApplicationMode::GenerateInput:
             GenerateLargeInputs();
             break;
+        case ApplicationMode::ConvertInputs:
+            ConvertAllTextToPointFiles(U"input-auto");
+            break;
+        case ApplicationMode::Benchmark:
+            RunBenchmark(BenchmarkConfig{ .epsilon = EPSILON });
+            break;
     }
 }
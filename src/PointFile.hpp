@@ -0,0 +1,465 @@
+# pragma once
+# include <Siv3D.hpp> // Siv3D v0.6.15
+# include <charconv>
+# include <condition_variable>
+# include <cstring>
+# include <fstream>
+# include <mutex>
+# include <span>
+# include <thread>
+# include "SmallestEnclosingCircle.hpp"
+# include "Generator.hpp"
+
+
+
+//-----------------------------
+// データ構造の定義
+//-----------------------------
+
+
+
+/** バイナリ形式の点群ファイルの先頭8バイト */
+constexpr std::array<char, 8> POINT_FILE_MAGIC = { 'S', 'E', 'C', 'P', 'O', 'I', 'N', 'T' };
+
+/** バイナリ形式の点群ファイルの版 */
+constexpr uint32 POINT_FILE_VERSION = 1;
+
+/**
+ * @brief バイナリ形式の点群ファイル（拡張子`.bin`）の先頭に置く64バイトのヘッダ。
+ * ヘッダの直後に`count`個の点が(x, y)の順にdoubleで詰めて並ぶ。値はすべて実行環境のバイト順（リトルエンディアン）で格納する。
+ * 点の並びはファイル先頭から64バイトの位置で始まるので、メモリにマップすればそのまま`Vec2`の配列として参照できる。
+ */
+struct PointFileHeader {
+    /** `POINT_FILE_MAGIC` */
+    std::array<char, 8> magic;
+    /** `POINT_FILE_VERSION` */
+    uint32 version;
+    /** 予約領域（0） */
+    uint32 reserved;
+    /** 点数 */
+    uint64 count;
+    /** 点群を囲む軸平行な長方形の最小・最大の座標。点数が0の場合はすべて0。 */
+    double min_x, min_y, max_x, max_y;
+    /** 点の並びを64ビット整数の列とみなして求めたFNV-1aハッシュ値 */
+    uint64 checksum;
+};
+static_assert(sizeof(PointFileHeader) == 64);
+
+/** @brief バイナリ形式の点群ファイルを読み取り専用でメモリにマップし、点群をコピーせずに参照する。 */
+class MappedPointFile {
+public:
+    /** @brief `filepath`のファイルをメモリにマップする。ヘッダが不正な場合やファイルが短い場合は`isValid()`が`false`になる。 */
+    explicit MappedPointFile(const FilePath& filepath);
+
+    /** ヘッダが正しく、ファイルに`header().count`個の点が含まれているか */
+    bool isValid() const noexcept { return m_valid; }
+
+    const PointFileHeader& header() const noexcept { return m_header; }
+
+    /** @brief マップされた点群を返す。ファイルが閉じられるまで（このオブジェクトが破棄されるまで）有効。 */
+    std::span<const Vec2> points() const noexcept;
+
+    /** @brief 点群のハッシュ値がヘッダに記録された値と一致するかを返す。点群全体を1回読むので、大きなファイルでは時間がかかる。 */
+    bool verifyChecksum() const;
+
+private:
+    MemoryMappedFileView m_file;
+    MappedMemoryView m_memory;
+    PointFileHeader m_header{};
+    bool m_valid = false;
+};
+
+/**
+ * @brief バイナリ形式の点群ファイルを、先頭から`chunk_points`点ずつの大きな塊で順に読む。
+ * 先読みを有効にすると、呼び出し側が1つの塊を処理している間に、別のスレッドで次の塊を読み込んでおく（二重バッファ）。
+ * 読み込み用のスレッドは`forEachChunk`の呼び出し（ファイルの走査）ごとに1つだけ立て、2つのバッファを交互に受け渡す。
+ * 使うメモリは、点の`chunk_points`個分のバッファ1つ（先読みする場合は2つ）だけで、ファイルの大きさによらない。
+ */
+class PointFileChunkReader {
+public:
+    /** @brief `filepath`のファイルを開いてヘッダを読む。ヘッダが不正な場合やファイルが短い場合は`isValid()`が`false`になる。 */
+    PointFileChunkReader(const FilePath& filepath, size_t chunk_points, bool read_ahead);
+
+    /** ヘッダが正しく、ファイルに`header().count`個の点が含まれているか */
+    bool isValid() const noexcept { return m_valid; }
+
+    const PointFileHeader& header() const noexcept { return m_header; }
+
+    /**
+     * @brief ファイルの点群を先頭から1回読み、塊ごとに`fun(first, chunk)`を呼ぶ。`first`は塊の先頭の点の、ファイル全体での添字。
+     * 渡した`chunk`は`fun`から戻るまで有効。読み込みに失敗した場合は`false`を返す。
+     */
+    bool forEachChunk(const std::function<void(uint64, std::span<const Vec2>)>& fun);
+
+private:
+    BinaryReader m_reader;
+    PointFileHeader m_header{};
+    size_t m_chunk_points;
+    bool m_read_ahead;
+    bool m_valid = false;
+    std::array<Array<Vec2>, 2> m_buffers;
+};
+
+/** @brief `SmallestEnclosingCircleOutOfCore`の設定 */
+struct OutOfCoreConfig {
+    /** 1回の読み込みで読む点数。読み込み用のバッファは1つあたりこの点数の16倍[バイト]になる。 */
+    size_t chunk_points = (1 << 20);
+    /** 作業用の点群（標本と、円に含まれなかった点）の点数の上限。使うメモリはおよそ`16 * (working_capacity + 2 * chunk_points)`バイトに収まる。 */
+    size_t working_capacity = (1 << 22);
+    /** 次の塊を別のスレッドで先読みするか */
+    bool read_ahead = true;
+    /** 最初の標本の点数。0の場合は点数Nから`Max(1024, 4√N)`とする（ただし`working_capacity`の半分以下）。 */
+    size_t sample_size = 0;
+    /** ファイルを走査し直す回数の上限。通常は数回で終わる。 */
+    size_t max_rounds = 32;
+    /** 点が円に含まれているかの判定時の許容誤差 */
+    double epsilon = 1e-8;
+    /** 標本を選ぶ乱数生成器の種 */
+    uint64 seed = 0;
+};
+
+/** @brief `SmallestEnclosingCircleOutOfCore`の結果 */
+struct OutOfCoreResult {
+    /** 求めた最小包含円 */
+    Circle circle;
+    /** 最後の走査で、全ての点が円に含まれていたか。`false`の場合は`max_rounds`回で打ち切っている。 */
+    bool converged;
+    /** ファイルを走査した回数（標本を選ぶ1回を含む） */
+    size_t passes;
+    /** 作業用の点群の点数の最大値 */
+    size_t peak_working_size;
+    /** ファイルから読んだ点の総数 */
+    uint64 points_read;
+};
+
+
+
+//-----------------------------
+// 主要関数の定義
+//-----------------------------
+
+
+
+/** @brief 点群`points`を64ビット整数の列とみなして、FNV-1aハッシュ値を求める。 */
+uint64 PointFileChecksum(const std::span<const Vec2> points) {
+    uint64 hash = 14695981039346656037ull;
+    for (const Vec2& point : points) {
+        uint64 words[2];
+        std::memcpy(words, &point, sizeof(words));
+        hash = (hash ^ words[0]) * 1099511628211ull;
+        hash = (hash ^ words[1]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+/** @brief 点群`points`をバイナリ形式で`filepath`に書き出す。 */
+bool WritePointFile(const FilePath& filepath, const std::span<const Vec2> points) {
+    PointFileHeader header{};
+    header.magic = POINT_FILE_MAGIC;
+    header.version = POINT_FILE_VERSION;
+    header.count = points.size();
+    if (not points.empty()) {
+        header.min_x = header.max_x = points[0].x;
+        header.min_y = header.max_y = points[0].y;
+        for (const Vec2& point : points) {
+            header.min_x = Min(header.min_x, point.x);
+            header.min_y = Min(header.min_y, point.y);
+            header.max_x = Max(header.max_x, point.x);
+            header.max_y = Max(header.max_y, point.y);
+        }
+    }
+    header.checksum = PointFileChecksum(points);
+
+    BinaryWriter writer{filepath};
+    if (not writer) { return false; }
+    const int64 data_size = static_cast<int64>(points.size_bytes());
+    return (writer.write(&header, sizeof(header)) == sizeof(header))
+        and (writer.write(points.data(), data_size) == data_size);
+}
+
+MappedPointFile::MappedPointFile(const FilePath& filepath)
+    : m_file{filepath} {
+    if (not m_file) { return; }
+    m_memory = m_file.mapAll();
+    if ((m_memory.data == nullptr) or (m_memory.size < sizeof(PointFileHeader))) { return; }
+    std::memcpy(&m_header, m_memory.data, sizeof(PointFileHeader));
+    m_valid =
+        (m_header.magic == POINT_FILE_MAGIC)
+        and (m_header.version == POINT_FILE_VERSION)
+        and (m_header.count <= ((m_memory.size - sizeof(PointFileHeader)) / sizeof(Vec2)));
+}
+
+std::span<const Vec2> MappedPointFile::points() const noexcept {
+    if (not m_valid) { return {}; }
+    return { reinterpret_cast<const Vec2*>(m_memory.data + sizeof(PointFileHeader)), static_cast<size_t>(m_header.count) };
+}
+
+bool MappedPointFile::verifyChecksum() const {
+    return m_valid and (PointFileChecksum(points()) == m_header.checksum);
+}
+
+PointFileChunkReader::PointFileChunkReader(const FilePath& filepath, const size_t chunk_points, const bool read_ahead)
+    : m_reader{filepath}
+    , m_chunk_points{Max<size_t>(chunk_points, 1)}
+    , m_read_ahead{read_ahead} {
+    if ((not m_reader) or (m_reader.read(&m_header, sizeof(PointFileHeader)) != sizeof(PointFileHeader))) { return; }
+    const int64 data_size = (m_reader.size() - static_cast<int64>(sizeof(PointFileHeader)));
+    m_valid =
+        (m_header.magic == POINT_FILE_MAGIC)
+        and (m_header.version == POINT_FILE_VERSION)
+        and (m_header.count <= (static_cast<uint64>(data_size) / sizeof(Vec2)));
+    if (not m_valid) { return; }
+    const size_t buffer_points = static_cast<size_t>(Min<uint64>(m_chunk_points, m_header.count));
+    m_buffers[0].resize(buffer_points);
+    if (m_read_ahead) { m_buffers[1].resize(buffer_points); }
+}
+
+bool PointFileChunkReader::forEachChunk(const std::function<void(uint64, std::span<const Vec2>)>& fun) {
+    if (not m_valid) { return false; }
+    const uint64 count = m_header.count;
+    // [first, first + size)の点を`buffer`に読み、読めた場合に限り読んだ点数を返す。
+    const auto read_chunk = [this, count](Array<Vec2>& buffer, const uint64 first) -> size_t {
+        const size_t size = static_cast<size_t>(Min<uint64>(m_chunk_points, (count - first)));
+        const int64 bytes = static_cast<int64>(size * sizeof(Vec2));
+        return (m_reader.read(buffer.data(), bytes) == bytes) ? size : 0;
+    };
+
+    m_reader.setPos(sizeof(PointFileHeader));
+    if (not m_read_ahead) {
+        for (uint64 first = 0; first < count; ) {
+            const size_t size = read_chunk(m_buffers[0], first);
+            if (size == 0) { return false; }
+            fun(first, std::span<const Vec2>{ m_buffers[0].data(), size });
+            first += size;
+        }
+        return true;
+    }
+
+    // 先読みでは、走査ごとに読み込み用のスレッドを1つだけ立て、2つのバッファを交互に受け渡す。
+    // filled[b]はバッファbに読み込まれ、まだ処理されていない点数（0であれば空き）。
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::array<size_t, 2> filled{ 0, 0 };
+    bool read_failed = false;
+    bool stopping = false;
+    std::thread reader{ [&]() {
+        size_t b = 0;
+        for (uint64 first = 0; first < count; ) {
+            {
+                std::unique_lock lock{ mutex };
+                changed.wait(lock, [&]() { return stopping or (filled[b] == 0); });
+                if (stopping) { return; }
+            }
+            const size_t size = read_chunk(m_buffers[b], first);
+            {
+                std::lock_guard lock{ mutex };
+                if (size == 0) { read_failed = true; }
+                else { filled[b] = size; }
+            }
+            changed.notify_all();
+            if (size == 0) { return; }
+            first += size;
+            b = (1 - b);
+        }
+    } };
+    const auto stop_reader = [&]() {
+        {
+            std::lock_guard lock{ mutex };
+            stopping = true;
+        }
+        changed.notify_all();
+        reader.join();
+    };
+
+    bool succeeded = true;
+    try {
+        size_t b = 0;
+        for (uint64 first = 0; first < count; ) {
+            size_t size;
+            {
+                std::unique_lock lock{ mutex };
+                changed.wait(lock, [&]() { return read_failed or (filled[b] != 0); });
+                size = filled[b];
+            }
+            // 読み込みに失敗した塊より前の塊は、全て処理してから戻る。
+            if (size == 0) {
+                succeeded = false;
+                break;
+            }
+            fun(first, std::span<const Vec2>{ m_buffers[b].data(), size });
+            {
+                std::lock_guard lock{ mutex };
+                filled[b] = 0;
+            }
+            changed.notify_all();
+            first += size;
+            b = (1 - b);
+        }
+    }
+    catch (...) {
+        stop_reader();
+        throw;
+    }
+    stop_reader();
+    return succeeded;
+}
+
+/**
+ * @brief メモリに載らない大きさのバイナリ形式の点群ファイル`filepath`の最小包含円を、ファイルを塊ごとに読み直しながら求める。
+ *
+ * 1. ファイルを1回走査して、無作為に選んだ添字の点を標本として取り出し、
+ *
+ * 2. 作業用の点群（最初は標本）の最小包含円を`SmallestEnclosingCircle`で求めて、
+ *
+ * 3. ファイルを走査し直し、円に含まれない点を作業用の点群に追加する。含まれない点がなくなるまで2, 3を繰り返す（Clarksonの方法）。
+ *
+ * 作業用の点群が`config.working_capacity`の半分を超えたら凸包の頂点だけに減らし、それでも上限に達した場合はその走査で追加するのをやめる（次の走査で改めて見つかる）。
+ * 最後の円は作業用の点群の最小包含円で、全ての点を含むので、全ての点をメモリに読み込んで解いた場合と同じ円になる。
+ * ファイルが読めない場合は空の`Optional`を返す。テキスト形式のファイルは、`ConvertTextToPointFile`でバイナリ形式に変換してから渡す。
+ */
+Optional<OutOfCoreResult> SmallestEnclosingCircleOutOfCore(const FilePath& filepath, const OutOfCoreConfig& config = {}) {
+    PointFileChunkReader reader{filepath, config.chunk_points, config.read_ahead};
+    if (not reader.isValid()) { return {}; }
+
+    const uint64 count = reader.header().count;
+    if (count == 0) { return OutOfCoreResult{ Circle{}, true, 0, 0, 0 }; }
+
+    const size_t capacity = Max<size_t>(config.working_capacity, 8);
+    const size_t sample_size = Min<size_t>(
+        (config.sample_size != 0) ? config.sample_size : Max<size_t>(1024, static_cast<size_t>(std::sqrt(static_cast<double>(count)) * 4)),
+        (capacity / 2));
+
+    DefaultRNG rng;
+    rng.seed(config.seed);
+    OutOfCoreResult result{ Circle{}, false, 0, 0, 0 };
+
+    // 標本の添字を先に決めて昇順に並べておけば、1回の順読みで取り出せる。
+    Array<uint64> sample_indices(sample_size);
+    {
+        std::uniform_int_distribution<uint64> dist{ 0, (count - 1) };
+        for (auto& index : sample_indices) { index = dist(rng); }
+        std::ranges::sort(sample_indices);
+    }
+    Array<Vec2> working;
+    working.reserve(capacity);
+    {
+        size_t k = 0;
+        const bool read = reader.forEachChunk([&](const uint64 first, const std::span<const Vec2> chunk) {
+            for (; (k < sample_indices.size()) and (sample_indices[k] < (first + chunk.size())); k++) {
+                working << chunk[static_cast<size_t>(sample_indices[k] - first)];
+            }
+        });
+        if (not read) { return {}; }
+        result.passes++;
+        result.points_read += count;
+    }
+
+    for (size_t round = 0; round < config.max_rounds; round++) {
+        result.circle = SmallestEnclosingCircle(std::span<Vec2>{ working }, config.epsilon, rng);
+        result.peak_working_size = Max(result.peak_working_size, working.size());
+
+        // 凸包の内部の点は最小包含円を変えないので、作業用の点群が大きくなったら凸包の頂点だけを残す。
+        if ((capacity / 2) < working.size()) {
+            working = detail::ConvexHullVertices(working);
+        }
+
+        const detail::ContainmentBound bound = detail::MakeContainmentBound(result.circle, config.epsilon);
+        // 上限に達して追加できなかった点も数え、含まれない点が1つもなかった場合に限り終える。
+        uint64 uncontained = 0;
+        const bool read = reader.forEachChunk([&](uint64, const std::span<const Vec2> chunk) {
+            for (size_t i = detail::FindFirstUncontained(chunk.data(), 0, chunk.size(), bound); i < chunk.size();
+                i = detail::FindFirstUncontained(chunk.data(), (i + 1), chunk.size(), bound)) {
+                uncontained++;
+                if (working.size() < capacity) { working << chunk[i]; }
+            }
+        });
+        if (not read) { return {}; }
+        result.passes++;
+        result.points_read += count;
+
+        if (uncontained == 0) {
+            result.converged = true;
+            break;
+        }
+    }
+    return result;
+}
+
+/** @brief `[first, last)`の先頭の空白文字を読み飛ばす。 */
+const char* SkipWhitespace(const char* first, const char* last) {
+    while ((first != last) and ((*first == ' ') or (*first == '\t') or (*first == '\n') or (*first == '\r'))) { ++first; }
+    return first;
+}
+
+/**
+ * @brief テキスト形式（1行目に点数N、続くN行に"x y"）の内容`text`を解析する。形式が不正な場合は空の`Optional`を返す。
+ * `std::ifstream >>`と違ってロケールやストリームの状態を扱わず、`std::from_chars`で数値を直接読む。
+ */
+Optional<Array<Vec2>> ParsePointText(const std::string& text) {
+    const char* first = text.data();
+    const char* const last = text.data() + text.size();
+
+    size_t N = 0;
+    first = SkipWhitespace(first, last);
+    if (const auto [ptr, ec] = std::from_chars(first, last, N); ec == std::errc{}) { first = ptr; }
+    else { return {}; }
+
+    Array<Vec2> points(N);
+    for (Vec2& point : points) {
+        for (double* value : { &point.x, &point.y }) {
+            first = SkipWhitespace(first, last);
+        # if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+            const auto [ptr, ec] = std::from_chars(first, last, *value);
+            if ((ec != std::errc{}) or (ptr == first)) { return {}; }
+            first = ptr;
+        # else
+            // 浮動小数点数の from_chars が使えない標準ライブラリでは strtod で代用する。text は std::string なので、末尾で必ず止まる。
+            char* ptr = nullptr;
+            *value = std::strtod(first, &ptr);
+            if (ptr == first) { return {}; }
+            first = ptr;
+        # endif
+        }
+    }
+    return points;
+}
+
+/** @brief テキスト形式の点群ファイル`filepath`を読み取る。読み取れない場合は空の`Optional`を返す。 */
+Optional<Array<Vec2>> ReadTextPointFile(const FilePath& filepath) {
+    std::ifstream fin{filepath.toUTF8(), std::ios::binary};
+    if (not fin) { return {}; }
+    fin.seekg(0, std::ios::end);
+    std::string text(static_cast<size_t>(fin.tellg()), '\0');
+    fin.seekg(0, std::ios::beg);
+    fin.read(text.data(), text.size());
+    return ParsePointText(text);
+}
+
+/** @brief `filepath`がバイナリ形式の点群ファイル（拡張子`.bin`）かを返す。 */
+bool IsPointFile(const FilePath& filepath) {
+    return (FileSystem::Extension(filepath) == U"bin");
+}
+
+/** @brief テキスト形式の点群ファイル`text_path`を、バイナリ形式に変換して`binary_path`に書き出す。 */
+bool ConvertTextToPointFile(const FilePath& text_path, const FilePath& binary_path) {
+    const auto points = ReadTextPointFile(text_path);
+    return points and WritePointFile(binary_path, *points);
+}
+
+/** @brief バイナリ形式の点群ファイル`binary_path`を、テキスト形式に変換して`text_path`に書き出す。読めた上で書き出せた場合に限り`true`を返す。 */
+bool ConvertPointFileToText(const FilePath& binary_path, const FilePath& text_path) {
+    const MappedPointFile file{binary_path};
+    if (not file.verifyChecksum()) { return false; }
+    return WritePointsAsText(text_path, Array<Vec2>(file.points().begin(), file.points().end()));
+}
+
+/** @brief ディレクトリ`directory`にあるテキスト形式の点群ファイルを全て、同じ名前のバイナリ形式のファイルに変換する。 */
+void ConvertAllTextToPointFiles(const FilePath& directory) {
+    for (const FilePath& path : FileSystem::DirectoryContents(directory)) {
+        if (FileSystem::Extension(path) != U"txt") { continue; }
+        const FilePath binary_path = path.substr(0, path.size() - 3) + U"bin";
+        if (ConvertTextToPointFile(path, binary_path)) {
+            Console << U"wrote in {}"_fmt(binary_path);
+        }
+    }
+}
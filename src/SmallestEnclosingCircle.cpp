@@ -1,7 +1,700 @@
+# include <cassert>
+# include <condition_variable>
+# include <mutex>
+# include <queue>
+# include <thread>
 # include "SmallestEnclosingCircle.hpp"
 
 namespace s3d {
+	namespace detail {
+
+		void RemoveInteriorPoints(Array<Vec2>& points)
+		{
+			// 8 方向 (-y, x - y, x, x + y, y, -x + y, -x, -x - y) の極値点を求める。この順に並べると反時計回りの凸多角形になる。
+			std::array<Vec2, 8> extremes;
+			extremes.fill(points[0]);
+
+			for (const Vec2& p : points)
+			{
+				if (p.y < extremes[0].y) { extremes[0] = p; }
+				if ((extremes[1].x - extremes[1].y) < (p.x - p.y)) { extremes[1] = p; }
+				if (extremes[2].x < p.x) { extremes[2] = p; }
+				if ((extremes[3].x + extremes[3].y) < (p.x + p.y)) { extremes[3] = p; }
+				if (extremes[4].y < p.y) { extremes[4] = p; }
+				if ((extremes[5].y - extremes[5].x) < (p.y - p.x)) { extremes[5] = p; }
+				if (p.x < extremes[6].x) { extremes[6] = p; }
+				if ((p.x + p.y) < (extremes[7].x + extremes[7].y)) { extremes[7] = p; }
+			}
+
+			// 八角形に内接する軸平行な長方形。この内部にある点は、八角形との交差判定をせずに取り除ける。
+			const double left	= Max({ extremes[5].x, extremes[6].x, extremes[7].x });
+			const double right	= Min({ extremes[1].x, extremes[2].x, extremes[3].x });
+			const double bottom	= Max({ extremes[7].y, extremes[0].y, extremes[1].y });
+			const double top	= Min({ extremes[3].y, extremes[4].y, extremes[5].y });
+
+			// 重複する頂点を除いた八角形の辺
+			std::array<std::pair<Vec2, Vec2>, 8> edges;
+			size_t edgeCount = 0;
+
+			for (size_t i = 0; i < extremes.size(); ++i)
+			{
+				const Vec2& a = extremes[i];
+				const Vec2& b = extremes[(i + 1) % extremes.size()];
+
+				if (a != b)
+				{
+					edges[edgeCount++] = { a, b };
+				}
+			}
+
+			// 八角形が 3 辺未満に退化しているときは、内部と呼べる領域がない。
+			if (edgeCount < 3)
+			{
+				return;
+			}
+
+			points.remove_if([&](const Vec2& p)
+			{
+				if ((left < p.x) && (p.x < right) && (bottom < p.y) && (p.y < top))
+				{
+					return true;
+				}
+
+				for (size_t i = 0; i < edgeCount; ++i)
+				{
+					const auto& [a, b] = edges[i];
+
+					if ((b - a).cross(p - a) <= 0.0)
+					{
+						return false;
+					}
+				}
+
+				return true;
+			});
+		}
+
+		Array<Vec2> ConvexHullVertices(const Array<Vec2>& points)
+		{
+			const Polygon hull = Geometry2D::ConvexHull(points);
+
+			if (not hull.isEmpty())
+			{
+				return hull.outer();
+			}
+
+			if (points.isEmpty())
+			{
+				return{};
+			}
+
+			// すべての点が同一直線上にある（または同一点である）場合は、両端の 2 点だけを残せばよい。
+			const auto [first, last] = std::minmax_element(points.begin(), points.end(),
+				[](const Vec2& a, const Vec2& b) { return ((a.x < b.x) || ((a.x == b.x) && (a.y < b.y))); });
+			return{ *first, *last };
+		}
+
+		struct UncontainedScanner::State
+		{
+			std::span<const Vec2> points;
+
+			size_t threadCount = 1;
+
+			size_t chunkSize = 0;
+
+			ContainmentBound bound{};
+
+			Array<Array<Vec2>> uncontained;
+
+			std::mutex mutex;
+
+			// ワーカーに新しい探索を知らせる。generation が増えるたびに 1 回探索する。
+			std::condition_variable started;
+
+			// 呼び出したスレッドに、すべてのワーカーの探索が終わったことを知らせる。
+			std::condition_variable finished;
+
+			uint64 generation = 0;
+
+			size_t pending = 0;
+
+			bool stopping = false;
+
+			Array<std::thread> threads;
+
+			/// @brief t 番目の区間で円に含まれない点を uncontained[t] に集めます。
+			void scan(const size_t t)
+			{
+				const size_t n = points.size();
+				const size_t first = Min(n, (t * chunkSize));
+				const size_t last = Min(n, (first + chunkSize));
+				uncontained[t].clear();
+
+				for (size_t i = FindFirstUncontained(points.data(), first, last, bound); i < last;
+					i = FindFirstUncontained(points.data(), (i + 1), last, bound))
+				{
+					uncontained[t] << points[i];
+				}
+			}
+
+			void work(const size_t t)
+			{
+				uint64 seen = 0;
+
+				for (;;)
+				{
+					{
+						std::unique_lock lock{ mutex };
+						started.wait(lock, [&]() { return (stopping || (generation != seen)); });
+
+						if (stopping)
+						{
+							return;
+						}
+
+						seen = generation;
+					}
+
+					scan(t);
+
+					{
+						std::lock_guard lock{ mutex };
+
+						if (--pending == 0)
+						{
+							finished.notify_one();
+						}
+					}
+				}
+			}
+		};
+
+		UncontainedScanner::UncontainedScanner(const std::span<const Vec2> points, const size_t threadCount)
+			: m_state{ std::make_unique<State>() }
+		{
+			m_state->points = points;
+			m_state->threadCount = Max<size_t>(threadCount, 1);
+			m_state->chunkSize = ((points.size() + m_state->threadCount - 1) / m_state->threadCount);
+			m_state->uncontained.resize(m_state->threadCount);
+			m_state->threads.reserve(m_state->threadCount - 1);
+
+			for (size_t t = 1; t < m_state->threadCount; ++t)
+			{
+				m_state->threads.emplace_back([state = m_state.get(), t]() { state->work(t); });
+			}
+		}
+
+		UncontainedScanner::~UncontainedScanner()
+		{
+			{
+				std::lock_guard lock{ m_state->mutex };
+				m_state->stopping = true;
+			}
+
+			m_state->started.notify_all();
+
+			for (auto& thread : m_state->threads)
+			{
+				thread.join();
+			}
+		}
+
+		size_t UncontainedScanner::appendUncontained(const Circle& c, const double tolerance, Array<Vec2>& working)
+		{
+			State& state = *m_state;
+
+			{
+				std::lock_guard lock{ state.mutex };
+				state.bound = MakeContainmentBound(c, tolerance);
+				state.pending = state.threads.size();
+				++state.generation;
+			}
+
+			state.started.notify_all();
+			state.scan(0);
+
+			{
+				std::unique_lock lock{ state.mutex };
+				state.finished.wait(lock, [&]() { return (state.pending == 0); });
+			}
+
+			size_t count = 0;
+
+			for (const auto& uncontained : state.uncontained)
+			{
+				working.append(uncontained);
+				count += uncontained.size();
+			}
+
+			return count;
+		}
+
+		// 多倍長の展開: 互いに重ならない double の列を絶対値の昇順に並べ、その和で実数を誤差なく表す（Shewchuk, 1997）。
+		// 述語の高速な判定で符号が確定しない場合にだけ使うため、簡潔さを優先して Array で表す。
+		using Expansion = Array<double>;
+
+		/// @brief a + b を丸め誤差なしに、和 sum とその誤差 err の 2 項で表します。
+		static void TwoSum(const double a, const double b, double& sum, double& err)
+		{
+			sum = (a + b);
+			const double bVirtual = (sum - a);
+			const double aVirtual = (sum - bVirtual);
+			err = ((a - aVirtual) + (b - bVirtual));
+		}
+
+		/// @brief 展開 e に b を加えた展開を返します。0 の項は取り除きます。
+		[[nodiscard]]
+		static Expansion Grow(const Expansion& e, const double b)
+		{
+			Expansion h;
+			h.reserve(e.size() + 1);
+			double q = b;
+
+			for (const double ei : e)
+			{
+				double sum, err;
+				TwoSum(q, ei, sum, err);
+
+				if (err != 0.0)
+				{
+					h << err;
+				}
+
+				q = sum;
+			}
+
+			if (q != 0.0)
+			{
+				h << q;
+			}
+
+			return h;
+		}
+
+		/// @brief 展開 e, f の和を返します。
+		[[nodiscard]]
+		static Expansion Sum(Expansion e, const Expansion& f)
+		{
+			for (const double fi : f)
+			{
+				e = Grow(e, fi);
+			}
+
+			return e;
+		}
+
+		/// @brief 展開 e の符号を反転した展開を返します。
+		[[nodiscard]]
+		static Expansion Negate(Expansion e)
+		{
+			for (auto& ei : e)
+			{
+				ei = -ei;
+			}
+
+			return e;
+		}
+
+		/// @brief 展開 e, f の積を返します。
+		[[nodiscard]]
+		static Expansion Product(const Expansion& e, const Expansion& f)
+		{
+			Expansion result;
+
+			for (const double fi : f)
+			{
+				for (const double ei : e)
+				{
+					// FMA は積を 1 回だけ丸めるため、ei * fi の丸め誤差を正確に求められる。
+					const double product = (ei * fi);
+					const double err = std::fma(ei, fi, -product);
+					result = Grow(Grow(result, err), product);
+				}
+			}
+
+			return result;
+		}
+
+		/// @brief a - b を誤差なく表す展開を返します。
+		[[nodiscard]]
+		static Expansion Difference(const double a, const double b)
+		{
+			return Grow(Expansion{ a }, -b);
+		}
+
+		/// @brief 展開 e の値の符号を持つ double（絶対値が最大の項）を返します。値が 0 の場合は 0 を返します。
+		[[nodiscard]]
+		static double Approximate(const Expansion& e)
+		{
+			return (e.isEmpty() ? 0.0 : e.back());
+		}
+
+		double OrientationExact(const Vec2& a, const Vec2& b, const Vec2& c)
+		{
+			const Expansion left = Product(Difference(a.x, c.x), Difference(b.y, c.y));
+			const Expansion right = Product(Difference(a.y, c.y), Difference(b.x, c.x));
+			return Approximate(Sum(left, Negate(right)));
+		}
+
+		double InCircleExact(const Vec2& a, const Vec2& b, const Vec2& c, const Vec2& d)
+		{
+			const Expansion adx = Difference(a.x, d.x);
+			const Expansion ady = Difference(a.y, d.y);
+			const Expansion bdx = Difference(b.x, d.x);
+			const Expansion bdy = Difference(b.y, d.y);
+			const Expansion cdx = Difference(c.x, d.x);
+			const Expansion cdy = Difference(c.y, d.y);
+
+			const Expansion aLift = Sum(Product(adx, adx), Product(ady, ady));
+			const Expansion bLift = Sum(Product(bdx, bdx), Product(bdy, bdy));
+			const Expansion cLift = Sum(Product(cdx, cdx), Product(cdy, cdy));
+
+			const Expansion bc = Sum(Product(bdx, cdy), Negate(Product(cdx, bdy)));
+			const Expansion ca = Sum(Product(cdx, ady), Negate(Product(adx, cdy)));
+			const Expansion ab = Sum(Product(adx, bdy), Negate(Product(bdx, ady)));
+
+			return Approximate(Sum(Sum(Product(aLift, bc), Product(bLift, ca)), Product(cLift, ab)));
+		}
+
+		double InDiametralCircleExact(const Vec2& a, const Vec2& b, const Vec2& p)
+		{
+			const Expansion dotX = Product(Difference(p.x, a.x), Difference(p.x, b.x));
+			const Expansion dotY = Product(Difference(p.y, a.y), Difference(p.y, b.y));
+			return Approximate(Sum(dotX, dotY));
+		}
+
+		Circle SupportCircle::asCircle() const
+		{
+			Circle circle;
+
+			switch (count)
+			{
+			case 0:
+				return Circle{};
+			case 1:
+				return Circle{ points[0], 0.0 };
+			case 2:
+				circle = Circle{ points[0], points[1] };
+				break;
+			default:
+				{
+					// 3 点が円周上で近接していても精度が落ちにくいよう、1 点を原点に移してから外心を求める。
+					const Vec2 b = (points[1] - points[0]);
+					const Vec2 c = (points[2] - points[0]);
+					const double d = (2.0 * b.cross(c));
+					const double bLengthSq = b.lengthSq();
+					const double cLengthSq = c.lengthSq();
+					const Vec2 center{ (((c.y * bLengthSq) - (b.y * cLengthSq)) / d), (((b.x * cLengthSq) - (c.x * bLengthSq)) / d) };
+					circle = Circle{ (points[0] + center), center.length() };
+				}
+				break;
+			}
+
+			// 中心の丸め誤差があっても、支持点が倍精度の円に含まれるようにする。
+			for (size_t i = 0; i < count; ++i)
+			{
+				circle.r = Max(circle.r, circle.center.distanceFrom(points[i]));
+			}
+
+			return circle;
+		}
+
+		SupportCircle MakeSupportCircle(const Vec2& p0, const Vec2& p1, const Vec2& p2)
+		{
+			const double orientation = Orientation(p0, p1, p2);
+
+			if (0.0 < orientation)
+			{
+				return SupportCircle{ { p0, p1, p2 }, 3 };
+			}
+
+			if (orientation < 0.0)
+			{
+				return SupportCircle{ { p0, p2, p1 }, 3 };
+			}
+
+			// 厳密な演算では起こらないが、3 点が同一直線上にある場合は、残りの 1 点を含む両端の 2 点で表す。
+			if (InDiametralCircle(p0, p2, p1) <= 0.0)
+			{
+				return SupportCircle{ { p0, p2 }, 2 };
+			}
+
+			if (InDiametralCircle(p1, p2, p0) <= 0.0)
+			{
+				return SupportCircle{ { p1, p2 }, 2 };
+			}
+
+			return SupportCircle{ { p0, p1 }, 2 };
+		}
+
+		Sphere CircumscribedSphere(const Vec3& p0, const Vec3& p1, const Vec3& p2)
+		{
+			// 3 点が球面上で近接していても精度が落ちにくいよう、1 点を原点に移してから外心を求める。
+			const Vec3 a = (p1 - p0);
+			const Vec3 b = (p2 - p0);
+			const Vec3 normal = a.cross(b);
+			const double d = (2.0 * normal.lengthSq());
+
+			if (d == 0.0)
+			{
+				// 3 点が同一直線上にある場合は、最も離れた 2 点を直径の両端とする球が 3 点を含む。
+				const std::array<std::pair<Vec3, Vec3>, 3> pairs = { std::pair{ p0, p1 }, std::pair{ p0, p2 }, std::pair{ p1, p2 } };
+				const auto& [q0, q1] = *std::max_element(pairs.begin(), pairs.end(),
+					[](const auto& e0, const auto& e1) { return (e0.first.distanceFromSq(e0.second) < e1.first.distanceFromSq(e1.second)); });
+				return Sphere{ ((q0 + q1) * 0.5), (q0.distanceFrom(q1) * 0.5) };
+			}
+
+			const Vec3 center = (p0 + (((b * a.lengthSq()) - (a * b.lengthSq())).cross(normal) / d));
+
+			// 中心の丸め誤差があっても、3 点が倍精度の球に含まれるようにする。
+			return Sphere{ center, Max({ center.distanceFrom(p0), center.distanceFrom(p1), center.distanceFrom(p2) }) };
+		}
+
+		Sphere CircumscribedSphere(const Vec3& p0, const Vec3& p1, const Vec3& p2, const Vec3& p3)
+		{
+			const Vec3 a = (p1 - p0);
+			const Vec3 b = (p2 - p0);
+			const Vec3 c = (p3 - p0);
+			const double d = (2.0 * a.dot(b.cross(c)));
+
+			if (d == 0.0)
+			{
+				// 4 点が同一平面上にある場合は、3 点を通る最小の球のうち最大のものが 4 点を含む。
+				const std::array<Sphere, 4> candidates = {
+					CircumscribedSphere(p1, p2, p3), CircumscribedSphere(p0, p2, p3),
+					CircumscribedSphere(p0, p1, p3), CircumscribedSphere(p0, p1, p2) };
+				return *std::max_element(candidates.begin(), candidates.end(),
+					[](const Sphere& s0, const Sphere& s1) { return (s0.r < s1.r); });
+			}
+
+			const Vec3 center = (p0 + (((b.cross(c) * a.lengthSq()) + (c.cross(a) * b.lengthSq()) + (a.cross(b) * c.lengthSq())) / d));
+
+			// 中心の丸め誤差があっても、4 点が倍精度の球に含まれるようにする。
+			return Sphere{ center, Max({ center.distanceFrom(p0), center.distanceFrom(p1), center.distanceFrom(p2), center.distanceFrom(p3) }) };
+		}
+
+		/// @brief 円 c0, c1, c2 のすべてに内側から接し、3 円を含む円のうち最小のものを求めます（アポロニウスの問題）。
+		/// @param c0 円 0
+		/// @param c1 円 1
+		/// @param c2 円 2
+		/// @param tolerance 円が円に含まれているかの判定時の許容誤差
+		/// @return 3 円に内接する円。3 円の中心が一直線上にある場合など、数値的に求まらない場合は none
+		static Optional<Circle> EnclosingTangentCircle(const Circle& c0, const Circle& c1, const Circle& c2, const double tolerance)
+		{
+			// 中心 c と半径 R は |c - ci| = R - ri (i = 0, 1, 2) を満たす。c0 の中心を原点に移し、i = 1, 2 の式から i = 0 の式を引くと
+			// 2 di·c = |di|² - ri² + r0² + 2 (ri - r0) R という c の連立 1 次方程式になり、c = A + B R と表せる。
+			// これを |c| = R - r0 に代入すると、R の 2 次方程式 (|B|² - 1) R² + 2 (A·B + r0) R + (|A|² - r0²) = 0 が得られる。
+			const Vec2 d1 = (c1.center - c0.center);
+			const Vec2 d2 = (c2.center - c0.center);
+			const double det = (2 * d1.cross(d2));
+
+			if (det == 0)
+			{
+				return none;
+			}
+
+			const double u1 = (d1.lengthSq() - (c1.r * c1.r) + (c0.r * c0.r));
+			const double u2 = (d2.lengthSq() - (c2.r * c2.r) + (c0.r * c0.r));
+			const double v1 = (2 * (c1.r - c0.r));
+			const double v2 = (2 * (c2.r - c0.r));
+			const Vec2 A{ (((u1 * d2.y) - (u2 * d1.y)) / det), (((d1.x * u2) - (d2.x * u1)) / det) };
+			const Vec2 B{ (((v1 * d2.y) - (v2 * d1.y)) / det), (((d1.x * v2) - (d2.x * v1)) / det) };
+
+			const double a = (B.lengthSq() - 1);
+			const double b = (2 * (A.dot(B) + c0.r));
+			const double c = (A.lengthSq() - (c0.r * c0.r));
+
+			std::array<double, 2> roots;
+
+			if (a == 0)
+			{
+				if (b == 0)
+				{
+					return none;
+				}
+
+				roots = { (-c / b), (-c / b) };
+			}
+			else
+			{
+				const double discriminant = ((b * b) - (4 * a * c));
+
+				if (discriminant < 0)
+				{
+					return none;
+				}
+
+				// 桁落ちを避けるため、絶対値の大きい方の解を先に求め、解と係数の関係からもう一方を求める。
+				const double q = (-(b + std::copysign(std::sqrt(discriminant), b)) / 2);
+				roots = { (q / a), ((q != 0) ? (c / q) : (q / a)) };
+			}
+
+			Optional<Circle> result;
+
+			for (const double R : roots)
+			{
+				if ((R < Max({ c0.r, c1.r, c2.r })) || (result && (result->r <= R)))
+				{
+					continue;
+				}
+
+				const Circle circle{ (c0.center + A + (B * R)), R };
+
+				if (Contains(circle, c0, tolerance) && Contains(circle, c1, tolerance) && Contains(circle, c2, tolerance))
+				{
+					result = circle;
+				}
+			}
+
+			return result;
+		}
+
+		Circle GrowEnclosingCircleOfCircles(const std::span<const Circle> circles, const double tolerance)
+		{
+			Circle circle = circles[0];
+
+			for (size_t i = 1; i < circles.size(); ++i)
+			{
+				const Circle& c0 = circles[i];
+
+				if (Contains(circle, c0, tolerance))
+				{
+					continue;
+				}
+
+				circle = c0;
+
+				for (size_t j = 0; j < i; ++j)
+				{
+					const Circle& c1 = circles[j];
+
+					if (Contains(circle, c1, tolerance))
+					{
+						continue;
+					}
+
+					circle = Geometry2D::SmallestEnclosingCircle(c0, c1);
+
+					for (size_t k = 0; k < j; ++k)
+					{
+						const Circle& c2 = circles[k];
+
+						if (Contains(circle, c2, tolerance))
+						{
+							continue;
+						}
+
+						if (const auto tangent = EnclosingTangentCircle(c0, c1, c2, tolerance))
+						{
+							circle = *tangent;
+						}
+						else
+						{
+							circle = Geometry2D::SmallestEnclosingCircle(c0, c1, c2, tolerance);
+						}
+					}
+				}
+			}
+
+			return circle;
+		}
+
+		/// @brief satisfies(x) が真となる最大の非負の倍精度浮動小数点数 x を返します。
+		/// @param guess x の推定値。この値の前後数 ulp に x があれば、数回の評価で求まります。
+		/// @param satisfies 非負の x について、ある値以下でのみ真となる述語
+		/// @return satisfies(x) が真となる最大の x。satisfies(0) が偽の場合は -1, satisfies(∞) が真の場合は ∞
+		/// @remark 非負の倍精度浮動小数点数は、ビット列を符号なし整数とみなした順序と値の順序が一致するため、ビット列の上で二分探索します。
+		template <class Predicate>
+		static double LargestSatisfying(const double guess, Predicate satisfies)
+		{
+			constexpr double Infinity = std::numeric_limits<double>::infinity();
+
+			if (not satisfies(0.0))
+			{
+				return -1.0;
+			}
+
+			if (satisfies(Infinity))
+			{
+				return Infinity;
+			}
+
+			// satisfies(lo) が真、satisfies(hi) が偽であることを保ちながら範囲を狭める。
+			uint64 lo = 0;
+			uint64 hi = std::bit_cast<uint64>(Infinity);
+
+			if ((0.0 <= guess) && (guess < Infinity))
+			{
+				constexpr uint64 Slack = 4;
+				const uint64 g = std::bit_cast<uint64>(guess);
+
+				if ((Slack <= g) && satisfies(std::bit_cast<double>(g - Slack)))
+				{
+					lo = (g - Slack);
+				}
+
+				if (((g + Slack) < hi) && (not satisfies(std::bit_cast<double>(g + Slack))))
+				{
+					hi = (g + Slack);
+				}
+			}
+
+			while (1 < (hi - lo))
+			{
+				const uint64 mid = (lo + ((hi - lo) / 2));
+				(satisfies(std::bit_cast<double>(mid)) ? lo : hi) = mid;
+			}
+
+			return std::bit_cast<double>(lo);
+		}
+	}
+
     namespace Geometry2D {
+
+		double AbsoluteTolerance::threshold(const double rSquared) const
+		{
+			return detail::LargestSatisfying((rSquared + tolerance), [&](const double dSquared)
+			{
+				const double err = Max(0.0, (dSquared - rSquared));
+				return (err <= tolerance);
+			});
+		}
+
+		double RelativeTolerance::threshold(const double rSquared) const
+		{
+			return detail::LargestSatisfying((rSquared + (rSquared * tolerance)), [&](const double dSquared)
+			{
+				const double err = Max(0.0, (dSquared - rSquared));
+
+				if (rSquared == 0)
+				{
+					return (err <= 0.0);
+				}
+
+				return ((err / rSquared) <= tolerance);
+			});
+		}
+
+		double CombinedTolerance::threshold(const double rSquared) const
+		{
+			// detail::Contains と同じ演算で判定する述語から求めるので、距離の 2 乗との比較は Contains と同じ結果になる。
+			return detail::LargestSatisfying(Max((rSquared + tolerance), (rSquared + (rSquared * tolerance))), [&](const double dSquared)
+			{
+				const double err = Max(0.0, (dSquared - rSquared));
+
+				if (rSquared == 0)
+				{
+					return (err <= tolerance);
+				}
+
+				return (((err / rSquared) <= tolerance) || (err <= tolerance));
+			});
+		}
+
+		double ExactContainment::threshold(const double rSquared) const
+		{
+			return rSquared;
+		}
         
         //////////////////////////////////////////////////
         //
@@ -9,53 +702,1026 @@ namespace s3d {
         //
         //////////////////////////////////////////////////
 
-        Circle SmallestEnclosingCircle(const Vec2& p0, const Vec2& p1, const Vec2& p2)
+        Circle SmallestEnclosingCircle(const Vec2& p0, const Vec2& p1, const Vec2& p2)
+		{
+			// 三角形 (p0, p1, p2) に対して鈍角の存在を判定し、もしあればその対辺（最長辺）を弦とする円が最小の円となる。
+			if ((p1 - p0).dot(p2 - p0) <= 0.0)
+			{ 
+				return Circle{ p1, p2 };
+			}
+			
+			if ((p0 - p1).dot(p2 - p1) <= 0.0)
+			{
+				return Circle{ p0, p2 };
+			}
+
+			if ((p0 - p2).dot(p1 - p2) <= 0.0)
+			{
+				return Circle{ p0, p1 };
+			}
+			
+			// 鋭角三角形の場合は (p0, p1, p2) の外接円が最小となる。
+			return Triangle{ p0, p1, p2 }.getCircumscribedCircle();
+		}
+
+		Circle SmallestEnclosingCircle(const Vec2& p0, const Vec2& p1, const Vec2& p2, const Vec2& p3, const double tolerance)
+		{
+			Circle circle = SmallestEnclosingCircle(p0, p1, p2);
+			
+			if (not detail::Contains(circle, p3, tolerance))
+			{
+				circle = SmallestEnclosingCircle(p0, p1, p3);
+				
+				if (not detail::Contains(circle, p2, tolerance))
+				{
+					circle = SmallestEnclosingCircle(p0, p2, p3);
+					
+					if (not detail::Contains(circle, p1, tolerance))
+					{
+						circle = SmallestEnclosingCircle(p1, p2, p3);
+					}
+				}
+			}
+
+			return circle;
+		}
+
+		Circle SmallestEnclosingCircle(const Circle& c0, const Circle& c1)
+		{
+			const Vec2 d = (c1.center - c0.center);
+			const double distance = d.length();
+
+			if ((distance + c1.r) <= c0.r)
+			{
+				return c0;
+			}
+
+			if ((distance + c0.r) <= c1.r)
+			{
+				return c1;
+			}
+
+			// 中心を結ぶ直線上で、2 円の外側の端を直径の両端とする円になる。
+			const double r = ((distance + c0.r + c1.r) / 2);
+			return Circle{ (c0.center + (d * ((r - c0.r) / distance))), r };
+		}
+
+		Circle SmallestEnclosingCircle(const Circle& c0, const Circle& c1, const Circle& c2, const double tolerance)
+		{
+			// 2 円を含む最小の円が残りの 1 円も含むなら、そのうち最も小さいものが答えになる。そうでなければ、答えは 3 円すべてに内接する。
+			const std::array<std::pair<Circle, const Circle*>, 3> candidates = {{
+				{ SmallestEnclosingCircle(c0, c1), &c2 },
+				{ SmallestEnclosingCircle(c0, c2), &c1 },
+				{ SmallestEnclosingCircle(c1, c2), &c0 },
+			}};
+
+			Optional<Circle> result;
+
+			for (const auto& [circle, other] : candidates)
+			{
+				if (detail::Contains(circle, *other, tolerance) && ((not result) || (circle.r < result->r)))
+				{
+					result = circle;
+				}
+			}
+
+			if (not result)
+			{
+				result = detail::EnclosingTangentCircle(c0, c1, c2, tolerance);
+			}
+
+			if (not result)
+			{
+				// 数値的に内接円が求まらない場合は、2 円を含む円のうち最大のものを、3 円すべてを含むまで広げる。
+				Circle circle = std::ranges::max(candidates, {}, [](const auto& candidate) { return candidate.first.r; }).first;
+				circle.r = Max({ (circle.center.distanceFrom(c0.center) + c0.r), (circle.center.distanceFrom(c1.center) + c1.r), (circle.center.distanceFrom(c2.center) + c2.r) });
+				result = circle;
+			}
+
+			return *result;
+		}
+
+		Circle SmallestEnclosingCircle(Array<Circle> circles, const double tolerance)
+		{
+			return SmallestEnclosingCircle(std::move(circles), tolerance, GetDefaultRNG());
+		}
+
+		Circle SmallestEnclosingCircle(const RectF& rect)
+		{
+			// 長方形の外接円は、対角線を直径とする円になる。
+			return Circle{ rect.point(0), rect.point(2) };
+		}
+
+		Circle SmallestEnclosingCircle(const std::span<const RectF> rects, const double tolerance)
+		{
+			return SmallestEnclosingCircle(rects, tolerance, GetDefaultRNG());
+		}
+
+		Circle SmallestEnclosingCircle(const Polygon& polygon, const double tolerance)
+		{
+			return SmallestEnclosingCircle(polygon, tolerance, GetDefaultRNG());
+		}
+
+		Circle SmallestEnclosingCircleConvex(const std::span<const Vec2> vertices)
+		{
+			const size_t n = vertices.size();
+
+			if (n == 0)
+			{
+				return Circle{};
+			}
+			else if (n == 1)
+			{
+				return Circle{ vertices[0], 0.0 };
+			}
+			else if (n == 2)
+			{
+				return Circle{ vertices[0], vertices[1] };
+			}
+
+			// 頂点 b について、隣り合う頂点 a, c を通る円の半径と、内角の余弦を求める。
+			// 3 点が同一直線上にある場合の半径は無限大とし、内角が 180° であれば最初に取り除かれるようにする。
+			struct Key
+			{
+				double radius;
+
+				double cosAngle;
+
+				uint32 index;
+
+				uint32 version;
+
+				/// @brief 半径が大きいほど、半径が等しければ内角が大きい（余弦が小さい）ほど優先する
+				[[nodiscard]]
+				bool operator <(const Key& other) const noexcept
+				{
+					if (radius != other.radius)
+					{
+						return (radius < other.radius);
+					}
+
+					return (other.cosAngle < cosAngle);
+				}
+			};
+
+			Array<uint32> prev(n), next(n), version(n, 0);
+
+			for (size_t i = 0; i < n; ++i)
+			{
+				prev[i] = static_cast<uint32>((i + n - 1) % n);
+				next[i] = static_cast<uint32>((i + 1) % n);
+			}
+
+			const auto makeKey = [&](const uint32 i)
+			{
+				const Vec2& a = vertices[prev[i]];
+				const Vec2& b = vertices[i];
+				const Vec2& c = vertices[next[i]];
+				const Vec2 ba = (a - b), bc = (c - b);
+				const double lengths = (ba.length() * bc.length());
+				const double cross = std::abs(ba.cross(bc));
+				const double radius = ((cross == 0.0) ? Math::Inf : ((lengths * (a - c).length()) / (2.0 * cross)));
+				const double cosAngle = ((lengths == 0.0) ? -1.0 : (ba.dot(bc) / lengths));
+				return Key{ radius, cosAngle, i, version[i] };
+			};
+
+			std::priority_queue<Key> queue;
+
+			for (uint32 i = 0; i < n; ++i)
+			{
+				queue.push(makeKey(i));
+			}
+
+			// 頂点を取り除くと、その両隣の頂点の鍵が変わる。古い鍵は version で見分けて読み飛ばす。
+			size_t remaining = n;
+
+			while (2 < remaining)
+			{
+				const Key key = queue.top();
+				queue.pop();
+
+				if (key.version != version[key.index])
+				{
+					continue;
+				}
+
+				const uint32 i = key.index;
+
+				// 半径が最大の頂点の内角が鈍角でなければ、その頂点と両隣の 3 点を含む最小の円がすべての頂点を含む。
+				if (0.0 <= key.cosAngle)
+				{
+					return SmallestEnclosingCircle(vertices[prev[i]], vertices[i], vertices[next[i]]);
+				}
+
+				const uint32 a = prev[i], c = next[i];
+				next[a] = c;
+				prev[c] = a;
+				version[i] = UINT32_MAX;
+				--remaining;
+
+				if (2 < remaining)
+				{
+					++version[a];
+					++version[c];
+					queue.push(makeKey(a));
+					queue.push(makeKey(c));
+				}
+				else
+				{
+					return Circle{ vertices[a], vertices[c] };
+				}
+			}
+
+			return Circle{};
+		}
+
+		Circle SmallestEnclosingCircleConvex(const Polygon& convexPolygon)
+		{
+			return SmallestEnclosingCircleConvex(std::span<const Vec2>{ convexPolygon.outer() });
+		}
+
+		Circle SmallestEnclosingCircle(Array<Vec2> points, const double tolerance, const Prefilter prefilter)
+		{
+			return SmallestEnclosingCircle(std::move(points), tolerance, GetDefaultRNG(), prefilter);
+		}
+
+		Circle SmallestEnclosingCircle(Array<Vec2> points, SmallestEnclosingCircleStats& stats, const double tolerance, const Prefilter prefilter)
+		{
+			return SmallestEnclosingCircle(std::move(points), stats, tolerance, GetDefaultRNG(), prefilter);
+		}
+
+		Circle SmallestEnclosingCircle(const std::span<Vec2> points, const double tolerance)
+		{
+			return SmallestEnclosingCircle(points, tolerance, GetDefaultRNG());
+		}
+
+		Circle SmallestEnclosingCircle(const std::span<const Vec2> points, const double tolerance)
+		{
+			return SmallestEnclosingCircle(points, tolerance, GetDefaultRNG());
+		}
+
+		Circle SmallestEnclosingCircle(const std::span<const Float2> points, const double tolerance)
+		{
+			return SmallestEnclosingCircle(points, tolerance, GetDefaultRNG());
+		}
+
+		Circle SmallestEnclosingCircleParallel(const std::span<const Vec2> points, const double tolerance, const size_t threadCount)
+		{
+			return SmallestEnclosingCircleParallel(points, tolerance, GetDefaultRNG(), threadCount);
+		}
+
+		void SmallestEnclosingCircles(const std::span<const Vec2> points, const std::span<const size_t> offsets, Array<Circle>& results, const double tolerance, size_t threadCount)
+		{
+			const size_t count = (offsets.empty() ? 0 : (offsets.size() - 1));
+			assert(std::ranges::is_sorted(offsets) && "offsets must be non-decreasing");
+			assert((offsets.empty() || (offsets.back() <= points.size())) && "offsets must not exceed points.size()");
+			results.resize(count);
+
+			if (count == 0)
+			{
+				return;
+			}
+
+			if (threadCount == 0)
+			{
+				threadCount = Threading::GetConcurrency();
+			}
+
+			// スレッドを立てる費用に見合わない規模であれば、呼び出し元のスレッドで処理する。
+			constexpr size_t MinPointsPerThread = (1 << 14);
+			threadCount = Clamp<size_t>(((offsets.back() - offsets.front()) / MinPointsPerThread), 1, threadCount);
+
+			// 点群 [first, last) を処理する。結果がスレッド数や担当範囲の分け方によらないよう、乱数生成器は点群ごとにその番号を種として作る。
+			// DefaultRNG (SFMT) は種の設定で大きな内部状態を初期化し直し、数百点の点群では解く時間と同じくらいかかるので、状態が 64 ビットの SplitMix64 を使う。
+			const auto solve = [&](const size_t first, const size_t last)
+			{
+				Array<Vec2> buffer;
+
+				for (size_t i = first; i < last; ++i)
+				{
+					const std::span<const Vec2> cluster = points.subspan(offsets[i], (offsets[i + 1] - offsets[i]));
+
+					if (cluster.size() <= 4)
+					{
+						results[i] = detail::SmallestEnclosingCircleFew(detail::ContiguousPointsView{ cluster.data() }, cluster.size(), tolerance);
+						continue;
+					}
+
+					SplitMix64 rng{ i };
+					buffer.assign(cluster.begin(), cluster.end());
+					buffer.shuffle(rng);
+					detail::MoveAxisExtremesToFront(std::span<Vec2>{ buffer });
+					results[i] = detail::GrowEnclosingCircle(detail::ContiguousPointsView{ buffer.data() }, buffer.size(), tolerance);
+				}
+			};
+
+			if (threadCount == 1)
+			{
+				solve(0, count);
+				return;
+			}
+
+			const size_t chunkSize = ((count + threadCount - 1) / threadCount);
+			Array<std::thread> threads;
+			threads.reserve(threadCount);
+
+			for (size_t t = 0; t < threadCount; ++t)
+			{
+				threads.emplace_back(solve, Min(count, (t * chunkSize)), Min(count, ((t + 1) * chunkSize)));
+			}
+
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+		}
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircleRobust
+		//
+		//////////////////////////////////////////////////
+
+		Circle SmallestEnclosingCircleRobust(const std::span<const Vec2> points)
+		{
+			return SmallestEnclosingCircleRobust(points, GetDefaultRNG());
+		}
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircleApproximate
+		//
+		//////////////////////////////////////////////////
+
+		ApproximateEnclosingCircle SmallestEnclosingCircleApproximate(const std::span<const Vec2> points, const double epsilon)
+		{
+			SmallestEnclosingCircleStream stream{ epsilon };
+			stream.insert(points);
+			return stream.result();
+		}
+
+		SmallestEnclosingCircleStream::SmallestEnclosingCircleStream(const double epsilon)
+		{
+			// 任意の向きは、最も近い方向と π / k 以内の角をなす。そのため、1 / cos(π / k) <= 1 + epsilon となる k を選ぶ。
+			const size_t k = Max<size_t>(4, static_cast<size_t>(std::ceil(Math::Pi / std::acos(1.0 / (1.0 + epsilon)))));
+			m_directionX.resize(k);
+			m_directionY.resize(k);
+
+			for (size_t i = 0; i < k; ++i)
+			{
+				const double angle = ((Math::TwoPi * i) / k);
+				m_directionX[i] = std::cos(angle);
+				m_directionY[i] = std::sin(angle);
+			}
+
+			clear();
+		}
+
+		void SmallestEnclosingCircleStream::insert(const Vec2& p)
+		{
+			// 原点から遠い点群でも射影の比較で桁落ちしないよう、最初の点を基準とした相対座標で射影する。
+			if (m_count == 0)
+			{
+				m_origin = p;
+			}
+
+			const Vec2 d = (p - m_origin);
+			const size_t k = m_directionX.size();
+
+			for (size_t i = 0; i < k; ++i)
+			{
+				const double projection = ((d.x * m_directionX[i]) + (d.y * m_directionY[i]));
+
+				if (m_projections[i] < projection)
+				{
+					m_projections[i] = projection;
+					m_extremes[i] = p;
+				}
+			}
+
+			++m_count;
+		}
+
+		void SmallestEnclosingCircleStream::insert(const std::span<const Vec2> points)
+		{
+			for (const auto& p : points)
+			{
+				insert(p);
+			}
+		}
+
+		void SmallestEnclosingCircleStream::clear()
+		{
+			m_extremes.assign(m_directionX.size(), Vec2{ 0, 0 });
+			m_projections.assign(m_directionX.size(), -Math::Inf);
+			m_origin = Vec2{ 0, 0 };
+			m_count = 0;
+		}
+
+		ApproximateEnclosingCircle SmallestEnclosingCircleStream::result() const
+		{
+			if (m_count == 0)
+			{
+				return{};
+			}
+
+			// 原点から遠い点群や極端に小さい点群でも精度を保つよう、最初の点を原点に平行移動して座標の大きさを 1 程度にそろえ、
+			// 重複を除いてから最小包含円を求める。これにより許容誤差は実質的に相対誤差として働く。
+			const Vec2 origin = m_origin;
+			double extent = 0.0;
+
+			for (const auto& p : m_extremes)
+			{
+				extent = Max({ extent, Abs(p.x - origin.x), Abs(p.y - origin.y) });
+			}
+
+			if (extent == 0.0)
+			{
+				return{ Circle{ origin, 0.0 }, 1.0 };
+			}
+
+			Array<Vec2> extremes = m_extremes.map([&](const Vec2& p) { return ((p - origin) / extent); });
+			std::sort(extremes.begin(), extremes.end(), [](const Vec2& a, const Vec2& b) { return ((a.x < b.x) || ((a.x == b.x) && (a.y < b.y))); });
+			extremes.erase(std::unique(extremes.begin(), extremes.end()), extremes.end());
+
+			constexpr double Tolerance = 1e-12;
+			const Circle inner = SmallestEnclosingCircle(std::span<Vec2>{ extremes }, Tolerance);
+
+			// 許容誤差による判定の甘さも含めて、保持した点を確実に含む半径 r を求める。
+			const double rSquared = (inner.r * inner.r);
+			const double r = (std::sqrt(rSquared + Max(Tolerance, (Tolerance * rSquared))) * extent);
+			const Vec2 center = ((inner.center * extent) + origin);
+
+			// 円の中心から見た任意の点 p の向きは、ある方向 u と π / k 以内の角をなし、
+			// |p - c| cos(π / k) <= <p - c, u> <= <e - c, u> <= r が成り立つ（e は方向 u に最も遠い点）。
+			const double scale = (1.0 / std::cos(Math::Pi / m_directionX.size()));
+			const double radius = (r * scale);
+
+			// inner.r は保持した点の部分集合の最小包含円の半径なので、真の最小包含円の半径以下である。
+			return{ Circle{ center, radius }, (radius / (inner.r * extent)) };
+		}
+
+		size_t SmallestEnclosingCircleStream::directionCount() const noexcept
+		{
+			return m_directionX.size();
+		}
+
+		size_t SmallestEnclosingCircleStream::size() const noexcept
+		{
+			return m_count;
+		}
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircleTracker
+		//
+		//////////////////////////////////////////////////
+
+		SmallestEnclosingCircleTracker::SmallestEnclosingCircleTracker(const double tolerance)
+			: m_tolerance{ tolerance } {}
+
+		void SmallestEnclosingCircleTracker::insert(const Vec2& p)
 		{
-			// 三角形 (p0, p1, p2) に対して鈍角の存在を判定し、もしあればその対辺（最長辺）を弦とする円が最小の円となる。
-			if ((p1 - p0).dot(p2 - p0) <= 0.0)
-			{ 
-				return Circle{ p1, p2 };
+			if (m_count++ == 0)
+			{
+				m_circle = Circle{ p, 0.0 };
+				m_support[0] = p;
+				m_supportCount = 1;
+				m_candidates << p;
+				m_hullSize = 1;
+				return;
 			}
-			
-			if ((p0 - p1).dot(p2 - p1) <= 0.0)
+
+			if (not detail::Contains(m_circle, p, m_tolerance))
 			{
-				return Circle{ p0, p2 };
+				rebuild(p);
 			}
+			else if (m_supportCount == 3)
+			{
+				// 円を定める三角形の厳密に内部にある点は、凸包の内部にあるため今後も境界上に来ない。
+				const Vec2& a = m_support[0];
+				const Vec2& b = m_support[1];
+				const Vec2& c = m_support[2];
+				const double d0 = (b - a).cross(p - a);
+				const double d1 = (c - b).cross(p - b);
+				const double d2 = (a - c).cross(p - c);
 
-			if ((p0 - p2).dot(p1 - p2) <= 0.0)
+				if (((0.0 < d0) && (0.0 < d1) && (0.0 < d2))
+					|| ((d0 < 0.0) && (d1 < 0.0) && (d2 < 0.0)))
+				{
+					return;
+				}
+			}
+
+			m_candidates << p;
+
+			if (((m_hullSize * 2) + 64) < m_candidates.size())
 			{
-				return Circle{ p0, p1 };
+				compactCandidates();
 			}
-			
-			// 鋭角三角形の場合は (p0, p1, p2) の外接円が最小となる。
-			return Triangle{ p0, p1, p2 }.getCircumscribedCircle();
 		}
 
-		Circle SmallestEnclosingCircle(const Vec2& p0, const Vec2& p1, const Vec2& p2, const Vec2& p3, const double tolerance)
+		void SmallestEnclosingCircleTracker::insert(const std::span<const Vec2> points)
 		{
-			Circle circle = SmallestEnclosingCircle(p0, p1, p2);
-			
-			if (not detail::Contains(circle, p3, tolerance))
+			for (const auto& p : points)
 			{
-				circle = SmallestEnclosingCircle(p0, p1, p3);
-				
-				if (not detail::Contains(circle, p2, tolerance))
+				insert(p);
+			}
+		}
+
+		void SmallestEnclosingCircleTracker::clear()
+		{
+			m_circle = Circle{};
+			m_supportCount = 0;
+			m_count = 0;
+			m_candidates.clear();
+			m_hullSize = 0;
+		}
+
+		const Circle& SmallestEnclosingCircleTracker::circle() const noexcept
+		{
+			return m_circle;
+		}
+
+		std::span<const Vec2> SmallestEnclosingCircleTracker::supportPoints() const noexcept
+		{
+			return{ m_support.data(), m_supportCount };
+		}
+
+		size_t SmallestEnclosingCircleTracker::size() const noexcept
+		{
+			return m_count;
+		}
+
+		size_t SmallestEnclosingCircleTracker::candidateCount() const noexcept
+		{
+			return m_candidates.size();
+		}
+
+		void SmallestEnclosingCircleTracker::rebuild(const Vec2& p0)
+		{
+			// 新しい最小包含円は p0 を境界上に持つので、候補点だけを対象に、p0 を固定して円を広げ直す。
+			m_candidates.shuffle(m_rng);
+
+			const detail::ContiguousPointsView points{ m_candidates.data() };
+			const size_t n = m_candidates.size();
+			m_circle = Circle{ p0, 0.0 };
+			m_support[0] = p0;
+			m_supportCount = 1;
+			detail::ContainmentBound bound = detail::MakeContainmentBound(m_circle, m_tolerance);
+
+			for (size_t j = points.findFirstUncontained(0, n, bound); j < n;
+				j = points.findFirstUncontained((j + 1), n, bound))
+			{
+				const Vec2 p1 = points[j];
+				m_circle = Circle{ p0, p1 };
+				m_support[1] = p1;
+				m_supportCount = 2;
+				bound = detail::MakeContainmentBound(m_circle, m_tolerance);
+
+				for (size_t k = points.findFirstUncontained(0, j, bound); k < j;
+					k = points.findFirstUncontained((k + 1), j, bound))
 				{
-					circle = SmallestEnclosingCircle(p0, p2, p3);
-					
-					if (not detail::Contains(circle, p1, tolerance))
+					const Vec2 p2 = points[k];
+					m_circle = Triangle(p0, p1, p2).getCircumscribedCircle();
+					m_support[2] = p2;
+					m_supportCount = 3;
+					bound = detail::MakeContainmentBound(m_circle, m_tolerance);
+				}
+			}
+		}
+
+		void SmallestEnclosingCircleTracker::compactCandidates()
+		{
+			m_candidates = detail::ConvexHullVertices(m_candidates);
+			m_hullSize = m_candidates.size();
+		}
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircleWindow
+		//
+		//////////////////////////////////////////////////
+
+		SmallestEnclosingCircleWindow::SmallestEnclosingCircleWindow(const size_t windowSize, const double tolerance)
+			: m_windowSize{ windowSize }
+			, m_blockSize{ (windowSize == 0) ? 64 : Max<size_t>(16, static_cast<size_t>(std::sqrt(static_cast<double>(windowSize)))) }
+			, m_tolerance{ tolerance } {}
+
+		void SmallestEnclosingCircleWindow::push(const Vec2& p)
+		{
+			if (m_blocks.empty() || (m_blocks.back().points.size() == m_blockSize))
+			{
+				m_blocks.emplace_back();
+				m_blocks.back().points.reserve(m_blockSize);
+			}
+
+			Block& block = m_blocks.back();
+			block.points << p;
+
+			if (block.points.size() == m_blockSize)
+			{
+				block.hull = detail::ConvexHullVertices(block.points);
+			}
+
+			++m_size;
+
+			// 円に含まれる点が増えても最小包含円は変わらない。
+			if (m_circleValid && (not detail::Contains(m_circle, p, m_tolerance)))
+			{
+				m_circleValid = false;
+			}
+
+			if ((m_windowSize != 0) && (m_windowSize < m_size))
+			{
+				pop();
+			}
+		}
+
+		void SmallestEnclosingCircleWindow::pop()
+		{
+			if (m_size == 0)
+			{
+				return;
+			}
+
+			Block& block = m_blocks.front();
+			const Vec2 p = block.points[m_frontOffset];
+
+			if (++m_frontOffset == block.points.size())
+			{
+				m_blocks.pop_front();
+				m_frontOffset = 0;
+			}
+
+			--m_size;
+
+			// 境界から許容誤差より内側にある点は最小包含円を定める点ではないため、取り除いても円は変わらない。
+			if (m_circleValid)
+			{
+				const double rSquared = (m_circle.r * m_circle.r);
+				const double margin = Max(m_tolerance, (m_tolerance * rSquared));
+
+				if (rSquared <= ((m_circle.center - p).lengthSq() + margin))
+				{
+					m_circleValid = false;
+				}
+			}
+		}
+
+		void SmallestEnclosingCircleWindow::clear()
+		{
+			m_blocks.clear();
+			m_frontOffset = 0;
+			m_size = 0;
+			m_circleValid = false;
+		}
+
+		const Circle& SmallestEnclosingCircleWindow::circle() const
+		{
+			if (m_circleValid)
+			{
+				return m_circle;
+			}
+
+			// 途中まで取り除かれた先頭のブロックと、まだ埋まっていない末尾のブロックは点をそのまま、それ以外のブロックは凸包の頂点だけを集める。
+			m_gathered.clear();
+
+			for (size_t i = 0; i < m_blocks.size(); ++i)
+			{
+				const Block& block = m_blocks[i];
+
+				if ((i == 0) && (m_frontOffset != 0))
+				{
+					m_gathered.insert(m_gathered.end(), (block.points.begin() + m_frontOffset), block.points.end());
+				}
+				else if (block.points.size() == m_blockSize)
+				{
+					m_gathered.append(block.hull);
+				}
+				else
+				{
+					m_gathered.append(block.points);
+				}
+			}
+
+			m_circle = SmallestEnclosingCircle(std::span<Vec2>{ m_gathered }, m_tolerance, m_rng);
+			m_circleValid = true;
+			return m_circle;
+		}
+
+		size_t SmallestEnclosingCircleWindow::size() const noexcept
+		{
+			return m_size;
+		}
+
+		bool SmallestEnclosingCircleWindow::isEmpty() const noexcept
+		{
+			return (m_size == 0);
+		}
+
+		SmallestEnclosingCircleRangeIndex::SmallestEnclosingCircleRangeIndex(Array<Vec2> points, const double tolerance, const size_t blockSize)
+			: m_points{ std::move(points) }
+			, m_tolerance{ tolerance }
+			, m_blockSize{ Max<size_t>(blockSize, 1) }
+			, m_blockCount{ ((m_points.size() + m_blockSize - 1) / m_blockSize) }
+		{
+			if (m_blockCount == 0)
+			{
+				return;
+			}
+
+			// 節点 1 を根とし、節点 i の子を 2i, 2i + 1、ブロック k を節点 (m_blockCount + k) とする。
+			// 葉の個数が 2 の累乗でない場合、区間として意味を持たない節点もできるが、問い合わせでは使われない。
+			const size_t nodeCount = (m_blockCount * 2);
+			Array<Array<Vec2>> hulls(nodeCount);
+
+			for (size_t k = 0; k < m_blockCount; ++k)
+			{
+				const auto first = (m_points.begin() + (k * m_blockSize));
+				const auto last = (m_points.begin() + Min(((k + 1) * m_blockSize), m_points.size()));
+				hulls[m_blockCount + k] = detail::ConvexHullVertices(Array<Vec2>(first, last));
+			}
+
+			Array<Vec2> merged;
+
+			for (size_t i = (m_blockCount - 1); 1 <= i; --i)
+			{
+				merged.assign(hulls[i * 2].begin(), hulls[i * 2].end());
+				merged.append(hulls[i * 2 + 1]);
+				hulls[i] = detail::ConvexHullVertices(merged);
+			}
+
+			m_hullOffsets.resize(nodeCount + 1);
+
+			for (size_t i = 0; i < nodeCount; ++i)
+			{
+				m_hullOffsets[i + 1] = (m_hullOffsets[i] + hulls[i].size());
+			}
+
+			m_hullVertices.reserve(m_hullOffsets.back());
+
+			for (const auto& hull : hulls)
+			{
+				m_hullVertices.append(hull);
+			}
+		}
+
+		Circle SmallestEnclosingCircleRangeIndex::query(const size_t first, size_t last) const
+		{
+			last = Min(last, m_points.size());
+
+			if (last <= first)
+			{
+				return Circle{};
+			}
+
+			m_gathered.clear();
+
+			// 区間に完全に含まれるブロックは [firstBlock, lastBlock)。それ以外の端の点はそのまま集める。
+			const size_t firstBlock = ((first + m_blockSize - 1) / m_blockSize);
+			const size_t lastBlock = (last / m_blockSize);
+
+			if (lastBlock <= firstBlock)
+			{
+				m_gathered.insert(m_gathered.end(), (m_points.begin() + first), (m_points.begin() + last));
+			}
+			else
+			{
+				m_gathered.insert(m_gathered.end(), (m_points.begin() + first), (m_points.begin() + (firstBlock * m_blockSize)));
+				m_gathered.insert(m_gathered.end(), (m_points.begin() + (lastBlock * m_blockSize)), (m_points.begin() + last));
+
+				const auto appendHull = [&](const size_t node)
+				{
+					m_gathered.insert(m_gathered.end(),
+						(m_hullVertices.begin() + m_hullOffsets[node]), (m_hullVertices.begin() + m_hullOffsets[node + 1]));
+				};
+
+				for (size_t lo = (firstBlock + m_blockCount), hi = (lastBlock + m_blockCount); lo < hi; lo /= 2, hi /= 2)
+				{
+					if (lo & 1)
 					{
-						circle = SmallestEnclosingCircle(p1, p2, p3);
+						appendHull(lo++);
+					}
+
+					if (hi & 1)
+					{
+						appendHull(--hi);
 					}
 				}
 			}
 
-			return circle;
+			return SmallestEnclosingCircle(std::span<Vec2>{ m_gathered }, m_tolerance, m_rng);
+		}
+
+		size_t SmallestEnclosingCircleRangeIndex::size() const noexcept
+		{
+			return m_points.size();
+		}
+
+		const Array<Vec2>& SmallestEnclosingCircleRangeIndex::points() const noexcept
+		{
+			return m_points;
+		}
+
+		size_t SmallestEnclosingCircleRangeIndex::hullVertexCount() const noexcept
+		{
+			return m_hullVertices.size();
+		}
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircleSolver
+		//
+		//////////////////////////////////////////////////
+
+		SmallestEnclosingCircleSolver::SmallestEnclosingCircleSolver(const double tolerance)
+			: m_tolerance{ tolerance } {}
+
+		Circle SmallestEnclosingCircleSolver::solve(const std::span<const Vec2> points)
+		{
+			m_warmStarted = false;
+			return solveFrom(points, {});
+		}
+
+		Circle SmallestEnclosingCircleSolver::solve(const std::span<const Vec2> points, const std::span<const uint32> supportHint)
+		{
+			m_warmStarted = false;
+
+			// 範囲外の添字と重複を除いた、高々 3 点のヒント
+			std::array<uint32, 3> hint;
+			size_t hintCount = 0;
+
+			for (const uint32 index : supportHint)
+			{
+				if ((hintCount < hint.size()) && (index < points.size())
+					&& (std::find(hint.begin(), (hint.begin() + hintCount), index) == (hint.begin() + hintCount)))
+				{
+					hint[hintCount++] = index;
+				}
+			}
+
+			if (hintCount != 0)
+			{
+				// ヒントの点だけを解く。ヒントの一部だけで円が定まる（残りが円の内側にある）場合もあるので、
+				// 支持点はヒントそのものではなく、解いた結果で実際に円を定めている点にする。
+				m_order.assign(hint.begin(), (hint.begin() + hintCount));
+				const Circle c = solveOrdered(points, hintCount);
+
+				// ヒントの点の最小包含円がすべての点を含めば、それが点群の最小包含円になる。
+				if (containsAll(points, c))
+				{
+					m_warmStarted = true;
+					return m_circle;
+				}
+			}
+
+			return solveFrom(points, { hint.data(), hintCount });
+		}
+
+		Circle SmallestEnclosingCircleSolver::solve(const std::span<const Vec2> points, const Circle& circleHint, const double margin)
+		{
+			m_warmStarted = false;
+
+			const size_t n = points.size();
+
+			if ((n == 0) || (std::numeric_limits<uint32>::max() < n))
+			{
+				return solveFrom(points, {});
+			}
+
+			// 前回の円の中心から、半径の (1 - margin) 倍の円の外にある点だけを候補として集める。
+			const Circle inner{ circleHint.center, Max(0.0, (circleHint.r * (1.0 - margin))) };
+			const detail::ContainmentBound bound{ inner.center, (inner.r * inner.r) };
+			const size_t candidateLimit = (n / 4);
+			m_order.clear();
+
+			for (size_t i = detail::FindFirstUncontained(points.data(), 0, n, bound); i < n;
+				i = detail::FindFirstUncontained(points.data(), (i + 1), n, bound))
+			{
+				if (candidateLimit <= m_order.size())
+				{
+					return solveFrom(points, {});
+				}
+
+				m_order << static_cast<uint32>(i);
+			}
+
+			if (m_order.isEmpty())
+			{
+				return solveFrom(points, {});
+			}
+
+			const Circle c = solveOrdered(points, 0);
+
+			// 候補以外の点は内側の円に含まれるので、内側の円が c に含まれていれば、すべての点が c に含まれる。
+			if (detail::Contains(c, inner, 0.0) || containsAll(points, c))
+			{
+				m_warmStarted = true;
+				return m_circle;
+			}
+
+			const std::array<uint32, 3> support = m_support;
+			return solveFrom(points, { support.data(), m_supportCount });
+		}
+
+		const Circle& SmallestEnclosingCircleSolver::circle() const noexcept
+		{
+			return m_circle;
+		}
+
+		std::span<const uint32> SmallestEnclosingCircleSolver::supportIndices() const noexcept
+		{
+			return{ m_support.data(), m_supportCount };
+		}
+
+		bool SmallestEnclosingCircleSolver::warmStarted() const noexcept
+		{
+			return m_warmStarted;
 		}
 
-		Circle SmallestEnclosingCircle(Array<Vec2> points, const double tolerance)
+		bool SmallestEnclosingCircleSolver::containsAll(const std::span<const Vec2> points, const Circle& c) const
 		{
-			return SmallestEnclosingCircle(std::move(points), tolerance, GetDefaultRNG());
+			const detail::ContainmentBound bound = detail::MakeContainmentBound(c, m_tolerance);
+			return (detail::FindFirstUncontained(points.data(), 0, points.size(), bound) == points.size());
+		}
+
+		Circle SmallestEnclosingCircleSolver::solveOrdered(const std::span<const Vec2> points, const size_t frontCount)
+		{
+			// 先頭の frontCount 個はそのままにして、残りの添字だけをシャッフルする。
+			Shuffle((m_order.begin() + frontCount), m_order.end(), m_rng);
+
+			const size_t n = m_order.size();
+			m_coordinates.resize(n * 2);
+			double* const xs = m_coordinates.data();
+			double* const ys = (m_coordinates.data() + n);
+
+			for (size_t i = 0; i < n; ++i)
+			{
+				const Vec2& p = points[m_order[i]];
+				xs[i] = p.x;
+				ys[i] = p.y;
+			}
+
+			const detail::SeparatedPointsView view{ xs, ys };
+			const CombinedTolerance containment{ m_tolerance };
+			const detail::NoStatsRecorder recorder;
+			detail::BallGrower<2, detail::SeparatedPointsView, CombinedTolerance, detail::NoStatsRecorder> grower{ view, containment, recorder };
+			grower.run(n);
+
+			m_circle = grower.ball;
+			m_supportCount = grower.supportCount;
+
+			for (size_t k = 0; k < m_supportCount; ++k)
+			{
+				m_support[k] = m_order[grower.supportPositions[k]];
+			}
+
+			return m_circle;
+		}
+
+		Circle SmallestEnclosingCircleSolver::solveFrom(const std::span<const Vec2> points, const std::span<const uint32> front)
+		{
+			const size_t n = points.size();
+
+			if (n == 0)
+			{
+				m_circle = Circle{};
+				m_supportCount = 0;
+				return m_circle;
+			}
+
+			if (std::numeric_limits<uint32>::max() < n)
+			{
+				m_circle = SmallestEnclosingCircle(points, m_tolerance, m_rng);
+				m_supportCount = 0;
+				return m_circle;
+			}
+
+			// front の点を先頭に置くと、最初の円が最終的な円に近くなり、円を取り直す回数が減る。
+			m_order.resize(n);
+			std::iota(m_order.begin(), m_order.end(), 0u);
+
+			for (size_t k = 0; k < front.size(); ++k)
+			{
+				std::iter_swap((m_order.begin() + k), std::find((m_order.begin() + k), m_order.end(), front[k]));
+			}
+
+			return solveOrdered(points, front.size());
 		}
     }
-}
\ No newline at end of file
+
+	namespace Geometry3D {
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingSphere
+		//
+		//////////////////////////////////////////////////
+
+		Sphere SmallestEnclosingSphere(Array<Vec3> points, const double tolerance)
+		{
+			return SmallestEnclosingSphere(std::move(points), tolerance, GetDefaultRNG());
+		}
+	}
+}
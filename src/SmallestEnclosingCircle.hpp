@@ -1,9 +1,67 @@
 # pragma once
 # include <Siv3D.hpp> // Siv3D v0.6.15
+# include <deque>
 
 namespace s3d {
+
+	/// @brief 最小包含円を求める前に、明らかに円の内部にある点を取り除くかを表す型です。
+	using Prefilter = YesNo<struct Prefilter_tag>;
+
     namespace Geometry2D {
 
+		//////////////////////////////////////////////////
+		//
+		//	ContainmentPolicy
+		//
+		//////////////////////////////////////////////////
+
+		/// @brief 点が円に含まれているかの判定方法を表す型の要件です。
+		/// @remark threshold(r²) は、半径 r の円に含まれるとみなす点と円の中心の距離の 2 乗の上限を返します。
+		/// 円が変わるたびに 1 回だけ呼ばれ、点ごとの判定は距離の 2 乗とこの値の比較だけになります。
+		template <class Containment>
+		concept ContainmentPolicy = requires (const Containment& containment, double rSquared)
+		{
+			{ containment.threshold(rSquared) } -> std::convertible_to<double>;
+		};
+
+		/// @brief 点と円の中心の距離の 2 乗 d² が r² を超える量（絶対誤差）が tolerance 以下であれば、点が円に含まれているとみなします。
+		struct AbsoluteTolerance
+		{
+			double tolerance = 1e-8;
+
+			[[nodiscard]]
+			double threshold(double rSquared) const;
+		};
+
+		/// @brief 点と円の中心の距離の 2 乗 d² が r² を超える量の r² に対する比（相対誤差）が tolerance 以下であれば、点が円に含まれているとみなします。
+		/// @remark 半径が 0 の円には、中心と同じ点だけが含まれます。
+		struct RelativeTolerance
+		{
+			double tolerance = 1e-8;
+
+			[[nodiscard]]
+			double threshold(double rSquared) const;
+		};
+
+		/// @brief 相対誤差または絶対誤差が tolerance 以下であれば、点が円に含まれているとみなします。
+		/// @remark `double tolerance` を受け取る関数はこの判定方法を使います。判定結果は `detail::Contains` と一致します。
+		struct CombinedTolerance
+		{
+			double tolerance = 1e-8;
+
+			[[nodiscard]]
+			double threshold(double rSquared) const;
+		};
+
+		/// @brief 倍精度で計算した d² が r² 以下の場合に限り、点が円に含まれているとみなします。
+		/// @remark 許容誤差を使わないため、外接円の丸め誤差で円周上の点が含まれないと判定され、円を取り直す回数が増えることがあります。
+		/// 丸め誤差によらず正しい結果が必要な場合は `SmallestEnclosingCircleRobust` を使ってください。
+		struct ExactContainment
+		{
+			[[nodiscard]]
+			double threshold(double rSquared) const;
+		};
+
         //////////////////////////////////////////////////
 		//
 		//	SmallestEnclosingCircle
@@ -31,32 +89,773 @@ namespace s3d {
 		/// @brief 点群 points の最小包含円を返します。
 		/// @param points 点群
 		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param prefilter 8 方向の極値点からなる八角形の内部にある点を、シャッフルの前に取り除くか。点数が多い場合に高速になります。
 		/// @return 点群 points の最小包含円
 		[[nodiscard]]
-		Circle SmallestEnclosingCircle(Array<Vec2> points, double tolerance = 1e-8);
+		Circle SmallestEnclosingCircle(Array<Vec2> points, double tolerance = 1e-8, Prefilter prefilter = Prefilter::No);
 
 		/// @brief 点群 points の最小包含円を返します。
 		/// @tparam URBG 乱数生成器の型
 		/// @param points 点群
 		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
 		/// @param urbg 乱数生成器。このアルゴリズムには点群の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @param prefilter 8 方向の極値点からなる八角形の内部にある点を、シャッフルの前に取り除くか。点数が多い場合に高速になります。
 		/// @return 点群 points の最小包含円
 		SIV3D_CONCEPT_URBG
 		[[nodiscard]]
-		Circle SmallestEnclosingCircle(Array<Vec2> points, double tolerance, URBG&& urbg);
+		Circle SmallestEnclosingCircle(Array<Vec2> points, double tolerance, URBG&& urbg, Prefilter prefilter = Prefilter::No);
 
 		/// @brief 点群 points の最小包含円を返します。
 		/// @tparam URBG 乱数生成器の型
 		/// @param points 点群
 		/// @param urbg 乱数生成器。このアルゴリズムには点群の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
 		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param prefilter 8 方向の極値点からなる八角形の内部にある点を、シャッフルの前に取り除くか。点数が多い場合に高速になります。
+		/// @return 点群 points の最小包含円
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(Array<Vec2> points, URBG&& urbg, double tolerance = 1e-8, Prefilter prefilter = Prefilter::No);
+
+		/// @brief 点群 points の最小包含円を、点が円に含まれているかの判定方法 containment を指定して返します。
+		/// @tparam Containment 判定方法の型（`AbsoluteTolerance`, `RelativeTolerance`, `CombinedTolerance`, `ExactContainment` など）
+		/// @param points 点群
+		/// @param containment 点が円に含まれているかの判定方法
+		/// @param prefilter 8 方向の極値点からなる八角形の内部にある点を、シャッフルの前に取り除くか。点数が多い場合に高速になります。
+		/// @return 点群 points の最小包含円
+		template <ContainmentPolicy Containment>
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(Array<Vec2> points, const Containment& containment, Prefilter prefilter = Prefilter::No);
+
+		/// @brief 点群 points の最小包含円を、点が円に含まれているかの判定方法 containment を指定して返します。
+		/// @tparam Containment 判定方法の型（`AbsoluteTolerance`, `RelativeTolerance`, `CombinedTolerance`, `ExactContainment` など）
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群
+		/// @param containment 点が円に含まれているかの判定方法
+		/// @param urbg 乱数生成器。このアルゴリズムには点群の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @param prefilter 8 方向の極値点からなる八角形の内部にある点を、シャッフルの前に取り除くか。点数が多い場合に高速になります。
+		/// @return 点群 points の最小包含円
+		template <ContainmentPolicy Containment, class URBG>
+			requires std::uniform_random_bit_generator<std::remove_reference_t<URBG>>
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(Array<Vec2> points, const Containment& containment, URBG&& urbg, Prefilter prefilter = Prefilter::No);
+
+		/// @brief `SmallestEnclosingCircle` の実行中に、円を何回取り直したかなどを記録する構造体です。
+		/// @remark 遅い入力が、シャッフルの結果が悪かったためか、多くの点が円周の近くにあるなど入力の形状のためかを見分けるために使います。
+		/// 記録する関数は各値に加算するので、複数回の実行の合計を求めることもできます。
+		struct SmallestEnclosingCircleStats
+		{
+			/// @brief 最も外側のループで、円に含まれない点 p0 が見つかり、p0 のみを境界上に持つ円に取り直した回数
+			size_t outerRebuilds = 0;
+
+			/// @brief 2 重目のループで、円に含まれない点 p1 が見つかり、p0, p1 を直径の両端とする円に取り直した回数
+			size_t middleRebuilds = 0;
+
+			/// @brief 最も内側のループで、円に含まれない点 p2 が見つかり、p0, p1, p2 の外接円に取り直した回数
+			size_t innerRebuilds = 0;
+
+			/// @brief 点が円に含まれるかを判定した回数（SIMD でまとめて判定した場合も、結果を使った点の個数だけ数えます）
+			size_t containsTests = 0;
+
+			/// @brief 点群のシャッフルにかかった時間 [秒]
+			double shuffleSeconds = 0.0;
+		};
+
+		/// @brief 点群 points の最小包含円を返し、その過程を stats に記録します。
+		/// @param points 点群
+		/// @param stats 記録先。各値に今回の実行の分が加算されます。
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param prefilter 8 方向の極値点からなる八角形の内部にある点を、シャッフルの前に取り除くか。点数が多い場合に高速になります。
+		/// @return 点群 points の最小包含円
+		/// @remark stats を取らない `SmallestEnclosingCircle` は記録の処理を含まずにコンパイルされるため、記録のための実行時間の増加はありません。
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(Array<Vec2> points, SmallestEnclosingCircleStats& stats, double tolerance = 1e-8, Prefilter prefilter = Prefilter::No);
+
+		/// @brief 点群 points の最小包含円を返し、その過程を stats に記録します。
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群
+		/// @param stats 記録先。各値に今回の実行の分が加算されます。
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param urbg 乱数生成器。このアルゴリズムには点群の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @param prefilter 8 方向の極値点からなる八角形の内部にある点を、シャッフルの前に取り除くか。点数が多い場合に高速になります。
+		/// @return 点群 points の最小包含円
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(Array<Vec2> points, SmallestEnclosingCircleStats& stats, double tolerance, URBG&& urbg, Prefilter prefilter = Prefilter::No);
+
+		/// @brief 点群 points の最小包含円を返します。点群はコピーされず、呼び出し元のバッファの中でシャッフルされます。
+		/// @param points 点群。関数の実行後、点の順序は変更されています。
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @return 点群 points の最小包含円
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(std::span<Vec2> points, double tolerance = 1e-8);
+
+		/// @brief 点群 points の最小包含円を返します。点群はコピーされず、呼び出し元のバッファの中でシャッフルされます。
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群。関数の実行後、点の順序は変更されています。
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param urbg 乱数生成器。このアルゴリズムには点群の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @return 点群 points の最小包含円
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(std::span<Vec2> points, double tolerance, URBG&& urbg);
+
+		/// @brief 点群 points の最小包含円を返します。点群はコピーされず、呼び出し元のバッファの中でシャッフルされます。
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群。関数の実行後、点の順序は変更されています。
+		/// @param urbg 乱数生成器。このアルゴリズムには点群の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @return 点群 points の最小包含円
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(std::span<Vec2> points, URBG&& urbg, double tolerance = 1e-8);
+
+		/// @brief 点群 points の最小包含円を返します。点群は変更されず、点の代わりに 32 ビットの添字の並びがシャッフルされます。
+		/// @param points 点群
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @return 点群 points の最小包含円
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(std::span<const Vec2> points, double tolerance = 1e-8);
+
+		/// @brief 点群 points の最小包含円を返します。点群は変更されず、点の代わりに 32 ビットの添字の並びがシャッフルされます。
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param urbg 乱数生成器。このアルゴリズムには添字の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @return 点群 points の最小包含円
 		SIV3D_CONCEPT_URBG
 		[[nodiscard]]
-		Circle SmallestEnclosingCircle(Array<Vec2> points, URBG&& urbg, double tolerance = 1e-8);
-		
+		Circle SmallestEnclosingCircle(std::span<const Vec2> points, double tolerance, URBG&& urbg);
+
+		/// @brief 点群 points の最小包含円を返します。点群は変更されず、点の代わりに 32 ビットの添字の並びがシャッフルされます。
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群
+		/// @param urbg 乱数生成器。このアルゴリズムには添字の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @return 点群 points の最小包含円
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(std::span<const Vec2> points, URBG&& urbg, double tolerance = 1e-8);
+
+		/// @brief 単精度の点群 points の最小包含円を返します。点群は変更されず、単精度のままコピーしてシャッフルします。
+		/// @param points 点群
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @return 点群 points の最小包含円
+		/// @remark 判定は倍精度で行います。単精度で十分な大きな点群では、読み込むデータ量が Vec2 の半分になります。
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(std::span<const Float2> points, double tolerance = 1e-8);
+
+		/// @brief 単精度の点群 points の最小包含円を返します。点群は変更されず、単精度のままコピーしてシャッフルします。
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param urbg 乱数生成器。このアルゴリズムには点群の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @return 点群 points の最小包含円
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(std::span<const Float2> points, double tolerance, URBG&& urbg);
+
+		/// @brief 単精度の点群 points の最小包含円を返します。点群は変更されず、単精度のままコピーしてシャッフルします。
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群
+		/// @param urbg 乱数生成器。このアルゴリズムには点群の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @return 点群 points の最小包含円
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(std::span<const Float2> points, URBG&& urbg, double tolerance = 1e-8);
+
+		/// @brief 点群 points の最小包含円を、複数のスレッドを使って返します。
+		/// @param points 点群
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param threadCount 使用するスレッド数。0 の場合は `Threading::GetConcurrency()` の値を使います。
+		/// @return 点群 points の最小包含円
+		/// @remark 無作為に選んだ一部の点の最小包含円を求め、それに含まれない点を全点から並列に探して追加することを、含まれない点がなくなるまで繰り返します（Clarkson の方法）。
+		/// 100 万点以上の点群を想定しています。点数が少ない場合は `SmallestEnclosingCircle` と同じく 1 スレッドで求めます。
+		[[nodiscard]]
+		Circle SmallestEnclosingCircleParallel(std::span<const Vec2> points, double tolerance = 1e-8, size_t threadCount = 0);
+
+		/// @brief 点群 points の最小包含円を、複数のスレッドを使って返します。
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param urbg 乱数生成器。点の無作為抽出とシャッフルに使用します。
+		/// @param threadCount 使用するスレッド数。0 の場合は `Threading::GetConcurrency()` の値を使います。
+		/// @return 点群 points の最小包含円
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircleParallel(std::span<const Vec2> points, double tolerance, URBG&& urbg, size_t threadCount = 0);
+
+		/// @brief 1 つのバッファに連結された複数の点群について、それぞれの最小包含円を求めます。
+		/// @param points すべての点群を連結した点の配列
+		/// @param offsets 各点群の開始位置（CSR 形式）。i 番目の点群は points[offsets[i]] から points[offsets[i + 1] - 1] まで。要素数は点群の数 + 1 で、単調非減少かつ末尾が points.size() 以下である必要があります（デバッグビルドでは assert で確かめます）。
+		/// @param results i 番目の点群の最小包含円が results[i] に格納されます。点群の数に合わせて要素数が変更されます。
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param threadCount 使用するスレッド数。0 の場合は `Threading::GetConcurrency()` の値を使います。
+		/// @remark 4 点以下の点群は点数に応じた `SmallestEnclosingCircle` で直接求めます。スレッドごとに作業用バッファと乱数生成器を 1 つずつ使い回すため、点群ごとのメモリ確保は行いません。乱数生成器は点群ごとにその番号を種とする SplitMix64 を使うため、結果はスレッド数によりません。シャッフル後に各軸の極値点を先頭に移して、円を取り直す回数を減らします。
+		void SmallestEnclosingCircles(std::span<const Vec2> points, std::span<const size_t> offsets, Array<Circle>& results, double tolerance = 1e-8, size_t threadCount = 0);
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircle (Circle, RectF, Polygon)
+		//
+		//////////////////////////////////////////////////
+
+		/// @brief 円 c0, c1 を含む最小の円を返します。
+		/// @param c0 円 0
+		/// @param c1 円 1
+		/// @return 円 c0, c1 を含む最小の円。一方が他方を含む場合は、含む方の円
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(const Circle& c0, const Circle& c1);
+
+		/// @brief 円 c0, c1, c2 を含む最小の円を返します。
+		/// @param c0 円 0
+		/// @param c1 円 1
+		/// @param c2 円 2
+		/// @param tolerance 円が円に含まれているかの判定時の許容誤差。はみ出す距離の絶対誤差、または外側の円の半径に対する相対誤差がこの値以下であれば、含まれているとみなします。
+		/// @return 円 c0, c1, c2 を含む最小の円
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(const Circle& c0, const Circle& c1, const Circle& c2, double tolerance = 1e-8);
+
+		/// @brief 円の集合 circles のすべての円を含む最小の円を返します。
+		/// @param circles 円の集合
+		/// @param tolerance 円が円に含まれているかの判定時の許容誤差。はみ出す距離の絶対誤差、または外側の円の半径に対する相対誤差がこの値以下であれば、含まれているとみなします。
+		/// @return 円の集合 circles の最小包含円。circles が空の場合は Circle{}
+		/// @remark 円を点で近似せず、点群と同じ手順で円を広げていきます。点の代わりに、境界上に 1 点を持つ円はその円自身、2 点を直径とする円は 2 円に内接する円、外接円は 3 円に内接する円（アポロニウスの問題の解）になります。
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(Array<Circle> circles, double tolerance = 1e-8);
+
+		/// @brief 円の集合 circles のすべての円を含む最小の円を返します。
+		/// @tparam URBG 乱数生成器の型
+		/// @param circles 円の集合
+		/// @param tolerance 円が円に含まれているかの判定時の許容誤差。はみ出す距離の絶対誤差、または外側の円の半径に対する相対誤差がこの値以下であれば、含まれているとみなします。
+		/// @param urbg 乱数生成器。このアルゴリズムには円の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @return 円の集合 circles の最小包含円。circles が空の場合は Circle{}
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(Array<Circle> circles, double tolerance, URBG&& urbg);
+
+		/// @brief 円の集合 circles のすべての円を含む最小の円を返します。
+		/// @tparam URBG 乱数生成器の型
+		/// @param circles 円の集合
+		/// @param urbg 乱数生成器。このアルゴリズムには円の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @param tolerance 円が円に含まれているかの判定時の許容誤差。はみ出す距離の絶対誤差、または外側の円の半径に対する相対誤差がこの値以下であれば、含まれているとみなします。
+		/// @return 円の集合 circles の最小包含円。circles が空の場合は Circle{}
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(Array<Circle> circles, URBG&& urbg, double tolerance = 1e-8);
+
+		/// @brief 長方形 rect を含む最小の円（外接円）を返します。
+		/// @param rect 長方形
+		/// @return 長方形 rect の外接円
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(const RectF& rect);
+
+		/// @brief 長方形の集合 rects のすべての長方形を含む最小の円を返します。
+		/// @param rects 長方形の集合
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @return 長方形の集合 rects の最小包含円。rects が空の場合は Circle{}
+		/// @remark 長方形の頂点の最小包含円を求めます。頂点の配列は作らず、頂点の番号（32 ビット）の並びをシャッフルします。
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(std::span<const RectF> rects, double tolerance = 1e-8);
+
+		/// @brief 長方形の集合 rects のすべての長方形を含む最小の円を返します。
+		/// @tparam URBG 乱数生成器の型
+		/// @param rects 長方形の集合
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param urbg 乱数生成器。このアルゴリズムには頂点の番号の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @return 長方形の集合 rects の最小包含円。rects が空の場合は Circle{}
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(std::span<const RectF> rects, double tolerance, URBG&& urbg);
+
+		/// @brief 多角形 polygon を含む最小の円を返します。
+		/// @param polygon 多角形
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @return 多角形 polygon の最小包含円。polygon が空の場合は Circle{}
+		/// @remark 外周の頂点の最小包含円を求めます（穴は外周の内側にあるため影響しません）。頂点の配列はコピーせず、添字の並びをシャッフルします。
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(const Polygon& polygon, double tolerance = 1e-8);
+
+		/// @brief 多角形 polygon を含む最小の円を返します。
+		/// @tparam URBG 乱数生成器の型
+		/// @param polygon 多角形
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+		/// @param urbg 乱数生成器。このアルゴリズムには添字の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @return 多角形 polygon の最小包含円。polygon が空の場合は Circle{}
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircle(const Polygon& polygon, double tolerance, URBG&& urbg);
+
+		/// @brief 凸多角形の頂点 vertices を含む最小の円を、乱数を使わずに返します。
+		/// @param vertices 凸多角形の頂点。時計回り・反時計回りのどちらかの順に並んでいる必要があります。
+		/// @return 頂点 vertices の最小包含円。vertices が空の場合は Circle{}
+		/// @remark 隣り合う 3 頂点を通る円の半径が最大の頂点を、その頂点の内角が鈍角である限り取り除いていきます（Skyum の方法）。
+		/// 計算量は頂点数 h について最悪でも O(h log h) で、シャッフルを使う `SmallestEnclosingCircle()` と違って、同じ入力に対する実行時間と結果は毎回同じです。
+		/// `Geometry2D::ConvexHull()` の結果など、凸であることがわかっている入力に使います。凸でない入力に対する結果は保証されません。
+		[[nodiscard]]
+		Circle SmallestEnclosingCircleConvex(std::span<const Vec2> vertices);
+
+		/// @brief 凸多角形 convexPolygon を含む最小の円を、乱数を使わずに返します。
+		/// @param convexPolygon 凸多角形
+		/// @return 凸多角形 convexPolygon の最小包含円。convexPolygon が空の場合は Circle{}
+		/// @remark 外周の頂点に `SmallestEnclosingCircleConvex(std::span<const Vec2>)` を適用します。
+		[[nodiscard]]
+		Circle SmallestEnclosingCircleConvex(const Polygon& convexPolygon);
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircleRobust
+		//
+		//////////////////////////////////////////////////
+
+		/// @brief 点群 points の最小包含円を、許容誤差を使わずに返します。
+		/// @param points 点群
+		/// @return 点群 points の最小包含円
+		/// @remark 点が円に含まれるかを、円の中心と半径ではなく、円を定める 2 点または 3 点と入力の座標から符号が正確な述語で判定します。
+		/// 述語はまず倍精度で計算し、誤差の上界から符号が確定しない場合だけ誤差のない多倍長の展開で計算し直します。
+		/// 円を定める点の組は丸め誤差の影響を受けずに求まり、座標の大きさ（1e17 など）によらず正しい結果になります。返す円はそれを倍精度で表したものです。
+		[[nodiscard]]
+		Circle SmallestEnclosingCircleRobust(std::span<const Vec2> points);
+
+		/// @brief 点群 points の最小包含円を、許容誤差を使わずに返します。
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群
+		/// @param urbg 乱数生成器。このアルゴリズムには点群の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @return 点群 points の最小包含円
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Circle SmallestEnclosingCircleRobust(std::span<const Vec2> points, URBG&& urbg);
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircleApproximate
+		//
+		//////////////////////////////////////////////////
+
+		/// @brief 近似的な最小包含円と、その近似精度の保証を表す構造体です。
+		struct ApproximateEnclosingCircle
+		{
+			/// @brief すべての点を含む円
+			Circle circle;
+
+			/// @brief 保証される近似比。真の最小包含円の半径を r* とすると、circle.r <= approximationRatio * r* が成り立ちます。
+			double approximationRatio = 1.0;
+		};
+
+		/// @brief 点群 points を 1 回走査して、半径が最小包含円の (1 + epsilon) 倍以内の包含円を返します。
+		/// @param points 点群
+		/// @param epsilon 許容する半径の相対誤差（0 より大きい値）
+		/// @return すべての点を含む円と、保証される近似比
+		/// @remark `SmallestEnclosingCircleStream` を使います。点群をコピーやシャッフルせず、使用メモリは O(1/√epsilon) です。
+		[[nodiscard]]
+		ApproximateEnclosingCircle SmallestEnclosingCircleApproximate(std::span<const Vec2> points, double epsilon = 1e-3);
+
+		/// @brief 点を 1 つずつ受け取りながら、半径が最小包含円の (1 + epsilon) 倍以内の包含円を求めるクラスです。
+		/// @remark 等間隔な k 方向について、その方向に最も遠い点だけを保持します（k は 1 / cos(π / k) <= 1 + epsilon となる最小の値）。
+		/// 保持した点の最小包含円の半径を 1 / cos(π / k) 倍すると、受け取ったすべての点を含む円になります。
+		class SmallestEnclosingCircleStream
+		{
+		public:
+
+			/// @brief 空の点群で初期化します。
+			/// @param epsilon 許容する半径の相対誤差（0 より大きい値）
+			explicit SmallestEnclosingCircleStream(double epsilon = 1e-3);
+
+			/// @brief 点を追加します。
+			/// @param p 追加する点
+			void insert(const Vec2& p);
+
+			/// @brief 点群を追加します。
+			/// @param points 追加する点群
+			void insert(std::span<const Vec2> points);
+
+			/// @brief 追加された点を消去します。
+			void clear();
+
+			/// @brief これまでに追加された点群を含む近似的な最小包含円を返します。
+			/// @return すべての点を含む円と、保証される近似比。点が 1 つも追加されていない場合は Circle{}
+			[[nodiscard]]
+			ApproximateEnclosingCircle result() const;
+
+			/// @brief 保持する方向の数を返します。
+			/// @return 方向の数
+			[[nodiscard]]
+			size_t directionCount() const noexcept;
+
+			/// @brief これまでに追加された点の個数を返します。
+			/// @return 追加された点の個数
+			[[nodiscard]]
+			size_t size() const noexcept;
+
+		private:
+
+			/// @brief 各方向の単位ベクトルの x 成分・y 成分
+			Array<double> m_directionX, m_directionY;
+
+			/// @brief 各方向に最も遠い点と、その方向への射影
+			Array<Vec2> m_extremes;
+
+			Array<double> m_projections;
+
+			/// @brief 射影の基準点（最初に追加された点）
+			Vec2 m_origin{ 0, 0 };
+
+			size_t m_count = 0;
+		};
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircleTracker
+		//
+		//////////////////////////////////////////////////
+
+		/// @brief 点を 1 つずつ追加しながら、それまでに追加された点群の最小包含円を保持するクラスです。
+		/// @remark 追加された点が現在の円に含まれる場合は O(1) で処理します。含まれない場合は、新しい点を境界上に持つ円を、保持している候補点だけから求め直します。
+		/// 候補点は、それまでの点群の凸包の頂点と、まだ凸包に畳み込まれていない点からなり、凸包の頂点数の 2 倍程度に抑えられます。
+		class SmallestEnclosingCircleTracker
+		{
+		public:
+
+			SmallestEnclosingCircleTracker() = default;
+
+			/// @brief 空の点群で初期化します。
+			/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+			explicit SmallestEnclosingCircleTracker(double tolerance);
+
+			/// @brief 点を追加し、最小包含円を更新します。
+			/// @param p 追加する点
+			void insert(const Vec2& p);
+
+			/// @brief 点群を追加し、最小包含円を更新します。
+			/// @param points 追加する点群
+			void insert(std::span<const Vec2> points);
+
+			/// @brief 追加された点と最小包含円を消去します。
+			void clear();
+
+			/// @brief これまでに追加された点群の最小包含円を返します。
+			/// @return 最小包含円。点が 1 つも追加されていない場合は Circle{}
+			[[nodiscard]]
+			const Circle& circle() const noexcept;
+
+			/// @brief 現在の最小包含円を定める点（境界上にある 1 ～ 3 点）を返します。
+			/// @return 最小包含円を定める点
+			[[nodiscard]]
+			std::span<const Vec2> supportPoints() const noexcept;
+
+			/// @brief これまでに追加された点の個数を返します。
+			/// @return 追加された点の個数
+			[[nodiscard]]
+			size_t size() const noexcept;
+
+			/// @brief 今後最小包含円の境界上に来る可能性があるとして保持している点の個数を返します。
+			/// @return 保持している点の個数
+			[[nodiscard]]
+			size_t candidateCount() const noexcept;
+
+		private:
+
+			double m_tolerance = 1e-8;
+
+			Circle m_circle;
+
+			std::array<Vec2, 3> m_support;
+
+			size_t m_supportCount = 0;
+
+			size_t m_count = 0;
+
+			/// @brief 前回整理したときの凸包の頂点と、それ以降に追加された点
+			Array<Vec2> m_candidates;
+
+			/// @brief 前回整理したときの凸包の頂点数
+			size_t m_hullSize = 0;
+
+			DefaultRNG m_rng;
+
+			void rebuild(const Vec2& p);
+
+			void compactCandidates();
+		};
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircleWindow
+		//
+		//////////////////////////////////////////////////
+
+		/// @brief 直近に追加された点群（スライディングウィンドウ）の最小包含円を保持するクラスです。
+		/// @remark 点は追加された順に約 √W 個ずつのブロックに分けて保持し、埋まったブロックは凸包の頂点を前もって求めておきます。
+		/// 最小包含円は、各ブロックの凸包の頂点と、端のブロックの点だけから求めるため、ウィンドウ全体を解き直す必要はありません。
+		/// 円に含まれる点の追加と、境界上にない点の削除では円を求め直しません。
+		/// メモリ使用量はウィンドウ内の点数 W に比例し、それに加えて埋まったブロックごとに凸包の頂点を持ちます。
+		class SmallestEnclosingCircleWindow
+		{
+		public:
+
+			/// @brief 空のウィンドウを作成します。
+			/// @param windowSize ウィンドウの大きさ。点数がこの値を超えると、`push()` で最も古い点が自動的に取り除かれます。0 の場合は自動では取り除きません。
+			/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+			explicit SmallestEnclosingCircleWindow(size_t windowSize = 0, double tolerance = 1e-8);
+
+			/// @brief 点をウィンドウの末尾に追加します。
+			/// @param p 追加する点
+			void push(const Vec2& p);
+
+			/// @brief ウィンドウの先頭（最も古い点）を取り除きます。ウィンドウが空の場合は何もしません。
+			void pop();
+
+			/// @brief ウィンドウ内のすべての点を取り除きます。
+			void clear();
+
+			/// @brief ウィンドウ内の点群の最小包含円を返します。
+			/// @return ウィンドウ内の点群の最小包含円。ウィンドウが空の場合は Circle{}
+			[[nodiscard]]
+			const Circle& circle() const;
+
+			/// @brief ウィンドウ内の点の個数を返します。
+			/// @return ウィンドウ内の点の個数
+			[[nodiscard]]
+			size_t size() const noexcept;
+
+			/// @brief ウィンドウが空であるかを返します。
+			/// @return ウィンドウが空の場合 true, それ以外の場合は false
+			[[nodiscard]]
+			bool isEmpty() const noexcept;
+
+		private:
+
+			struct Block
+			{
+				/// @brief 追加された順の点
+				Array<Vec2> points;
+
+				/// @brief ブロックが埋まったときに求めた凸包の頂点
+				Array<Vec2> hull;
+			};
+
+			size_t m_windowSize = 0;
+
+			size_t m_blockSize = 64;
+
+			double m_tolerance = 1e-8;
+
+			std::deque<Block> m_blocks;
+
+			/// @brief 先頭のブロックのうち、すでに取り除かれた点の個数
+			size_t m_frontOffset = 0;
+
+			size_t m_size = 0;
+
+			mutable Circle m_circle;
+
+			mutable bool m_circleValid = false;
+
+			/// @brief 最小包含円を求めるときに点を集める作業用バッファ
+			mutable Array<Vec2> m_gathered;
+
+			mutable DefaultRNG m_rng;
+		};
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircleRangeIndex
+		//
+		//////////////////////////////////////////////////
+
+		/// @brief 点群の任意の連続区間 [first, last) の最小包含円を求めるための索引です。
+		/// @remark 点群を `blockSize` 個ずつのブロックに分け、ブロックを葉とするセグメント木の各節点に、その節点が表す区間の凸包の頂点を前もって求めておきます。
+		/// 区間の最小包含円は、区間を覆う O(log(N / B)) 個の節点の凸包の頂点と、両端の途中までのブロックの点（高々 2B 個）だけから求めるため、
+		/// 問い合わせの計算量は区間の長さではなく、集めた凸包の頂点数に比例します（N は点数、B はブロックの大きさ）。
+		///
+		/// メモリ使用量と構築時間はブロックの大きさと点群の形に依存します。
+		/// セグメント木の各段の凸包の頂点数の合計は N 以下なので、凸包の頂点は最悪でも N log2(N / B) 個（すべての点が凸位置にある場合）です。
+		/// 正規分布のように散らばった点群では、m 点の凸包の頂点は O(log m) 個程度しかないため、点群のコピー（N 個）に比べて無視できるほどです。
+		/// 構築時間は、葉の凸包に O(N log B)、内部の節点に子の凸包の頂点数について O(h log h) です。
+		/// ブロックを大きくすると、メモリ使用量と構築時間は減りますが、問い合わせごとに集める端の点が増えます。
+		class SmallestEnclosingCircleRangeIndex
+		{
+		public:
+
+			/// @brief 空の索引を作成します。
+			SmallestEnclosingCircleRangeIndex() = default;
+
+			/// @brief 点群から索引を作成します。
+			/// @param points 点群。索引は点群のコピーを保持します。
+			/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+			/// @param blockSize セグメント木の葉 1 つあたりの点の個数。0 の場合は 1 とみなします。
+			explicit SmallestEnclosingCircleRangeIndex(Array<Vec2> points, double tolerance = 1e-8, size_t blockSize = 64);
+
+			/// @brief 区間 [first, last) の点群の最小包含円を返します。
+			/// @param first 区間の先頭のインデックス
+			/// @param last 区間の終端のインデックス。点数より大きい場合は点数とみなします。
+			/// @return 区間の点群の最小包含円。区間が空の場合は Circle{}
+			/// @remark 作業用バッファと乱数生成器を共有するため、同じ索引に対して複数のスレッドから同時に呼び出すことはできません。
+			[[nodiscard]]
+			Circle query(size_t first, size_t last) const;
+
+			/// @brief 索引に含まれる点の個数を返します。
+			/// @return 索引に含まれる点の個数
+			[[nodiscard]]
+			size_t size() const noexcept;
+
+			/// @brief 索引に含まれる点群を返します。
+			/// @return 索引に含まれる点群
+			[[nodiscard]]
+			const Array<Vec2>& points() const noexcept;
+
+			/// @brief セグメント木の各節点が保持している凸包の頂点の総数を返します。
+			/// @return 凸包の頂点の総数。索引のメモリ使用量の目安になります。
+			[[nodiscard]]
+			size_t hullVertexCount() const noexcept;
+
+		private:
+
+			Array<Vec2> m_points;
+
+			double m_tolerance = 1e-8;
+
+			size_t m_blockSize = 64;
+
+			/// @brief ブロックの個数（葉の個数）
+			size_t m_blockCount = 0;
+
+			/// @brief 各節点の凸包の頂点を節点の番号順に詰めたもの。節点 i の頂点は [m_hullOffsets[i], m_hullOffsets[i + 1]) の範囲にある
+			Array<Vec2> m_hullVertices;
+
+			Array<size_t> m_hullOffsets;
+
+			/// @brief 最小包含円を求めるときに点を集める作業用バッファ
+			mutable Array<Vec2> m_gathered;
+
+			mutable DefaultRNG m_rng;
+		};
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingCircleSolver
+		//
+		//////////////////////////////////////////////////
+
+		/// @brief 少しずつ動く点群の最小包含円を毎フレーム求めるための、作業用バッファと乱数生成器を使い回すクラスです。
+		/// @remark 前回の結果をヒントとして渡すと、まずヒントだけから円を求め、点群全体がその円に含まれるかを 1 回の走査で確かめます。
+		/// 含まれていれば、その円が最小包含円であり、点群全体を解き直しません。含まれていなければ、ヒントの点を先頭に置いて点群全体を解き直します。
+		/// フレーム間で点群があまり動かない場合、1 フレームあたりの計算はほぼ包含判定の 1 回の走査だけになります。
+		/// ヒントの添字は、前回と今回で同じ点が同じ添字にあることを前提とします。
+		class SmallestEnclosingCircleSolver
+		{
+		public:
+
+			SmallestEnclosingCircleSolver() = default;
+
+			/// @brief 作業用バッファが空の状態で初期化します。
+			/// @param tolerance 点が円に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が円に含まれているとみなします。
+			explicit SmallestEnclosingCircleSolver(double tolerance);
+
+			/// @brief 点群 points の最小包含円を、ヒントを使わずに求めます。
+			/// @param points 点群
+			/// @return 点群 points の最小包含円。points が空の場合は Circle{}
+			Circle solve(std::span<const Vec2> points);
+
+			/// @brief 点群 points の最小包含円を、前回の最小包含円を定めていた点の添字 supportHint から求めます。
+			/// @param points 点群
+			/// @param supportHint 前回の最小包含円を定めていた点の points での添字（通常は `supportIndices()`）。範囲外の添字と 4 つ目以降は無視します。
+			/// @return 点群 points の最小包含円。points が空の場合は Circle{}
+			/// @remark supportHint の点の最小包含円がすべての点を含めば、包含判定の 1 回の走査だけで終わります。
+			Circle solve(std::span<const Vec2> points, std::span<const uint32> supportHint);
+
+			/// @brief 点群 points の最小包含円を、前回の最小包含円 circleHint から求めます。
+			/// @param points 点群
+			/// @param circleHint 前回の最小包含円
+			/// @param margin 点の移動量の見込み（circleHint の半径に対する比）。circleHint の中心から半径の (1 - margin) 倍より遠い点だけを候補にします。
+			/// @return 点群 points の最小包含円。points が空の場合は Circle{}
+			/// @remark 1 回の走査で候補の点を集めてその最小包含円を求め、それが半径 (1 - margin) 倍の円を含めば、候補以外の点も含むので走査はそれだけで終わります。
+			/// 候補が点群の 4 分の 1 より多い場合は、ヒントが役に立たないとみなして点群全体を解き直します。
+			Circle solve(std::span<const Vec2> points, const Circle& circleHint, double margin = 0.05);
+
+			/// @brief 最後に求めた最小包含円を返します。
+			/// @return 最後に求めた最小包含円
+			[[nodiscard]]
+			const Circle& circle() const noexcept;
+
+			/// @brief 最後に求めた最小包含円を定める点（境界上にある 1 ～ 3 点）の添字を返します。次のフレームの `solve()` にそのまま渡せます。
+			/// @return 最小包含円を定める点の添字。点数が 2^32 以上で添字を表せなかった場合は空
+			[[nodiscard]]
+			std::span<const uint32> supportIndices() const noexcept;
+
+			/// @brief 最後の `solve()` で、ヒントから最小包含円が確定し、点群全体の解き直しを省けたかを返します。
+			/// @return 解き直しを省けた場合 true, それ以外の場合は false
+			[[nodiscard]]
+			bool warmStarted() const noexcept;
+
+		private:
+
+			double m_tolerance = 1e-8;
+
+			Circle m_circle;
+
+			std::array<uint32, 3> m_support{};
+
+			size_t m_supportCount = 0;
+
+			bool m_warmStarted = false;
+
+			/// @brief 解く点の添字の並び（作業用バッファ）
+			Array<uint32> m_order;
+
+			/// @brief m_order の順に並べた点の x 座標・y 座標（作業用バッファ）
+			Array<double> m_coordinates;
+
+			DefaultRNG m_rng;
+
+			[[nodiscard]]
+			bool containsAll(std::span<const Vec2> points, const Circle& c) const;
+
+			Circle solveOrdered(std::span<const Vec2> points, size_t frontCount);
+
+			Circle solveFrom(std::span<const Vec2> points, std::span<const uint32> front);
+		};
     }
+
+	namespace Geometry3D {
+
+		//////////////////////////////////////////////////
+		//
+		//	SmallestEnclosingSphere
+		//
+		//////////////////////////////////////////////////
+
+		/// @brief 3 次元の点群 points の最小包含球を返します。
+		/// @param points 点群
+		/// @param tolerance 点が球に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が球に含まれているとみなします。
+		/// @return 点群 points の最小包含球。points が空の場合は中心が原点で半径が 0 の球
+		/// @remark `Geometry2D::SmallestEnclosingCircle` と同じ乱択逐次構成法を、次元をテンプレート引数とした実装で 3 次元に適用します。期待計算量は O(n) です。
+		[[nodiscard]]
+		Sphere SmallestEnclosingSphere(Array<Vec3> points, double tolerance = 1e-8);
+
+		/// @brief 3 次元の点群 points の最小包含球を返します。
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群
+		/// @param tolerance 点が球に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が球に含まれているとみなします。
+		/// @param urbg 乱数生成器。このアルゴリズムには点群の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @return 点群 points の最小包含球。points が空の場合は中心が原点で半径が 0 の球
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Sphere SmallestEnclosingSphere(Array<Vec3> points, double tolerance, URBG&& urbg);
+
+		/// @brief 3 次元の点群 points の最小包含球を返します。
+		/// @tparam URBG 乱数生成器の型
+		/// @param points 点群
+		/// @param urbg 乱数生成器。このアルゴリズムには点群の順序をシャッフルする処理が含まれていて、乱数生成器を使用します。
+		/// @param tolerance 点が球に含まれているかの判定時の許容誤差。相対誤差または絶対誤差がこの値以下であれば、点が球に含まれているとみなします。
+		/// @return 点群 points の最小包含球。points が空の場合は中心が原点で半径が 0 の球
+		SIV3D_CONCEPT_URBG
+		[[nodiscard]]
+		Sphere SmallestEnclosingSphere(Array<Vec3> points, URBG&& urbg, double tolerance = 1e-8);
+	}
 }
 
 # include "SmallestEnclosingCircle.ipp"
 
-using namespace s3d::Geometry2D;
\ No newline at end of file
+using namespace s3d::Geometry2D;
+using namespace s3d::Geometry3D;
@@ -1,5 +1,15 @@
 # pragma once
 # include <Siv3D.hpp>
+# include <bit>
+# include <chrono>
+# include <numeric>
+# include <span>
+
+# if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#	include <immintrin.h>
+# elif defined(__ARM_NEON)
+#	include <arm_neon.h>
+# endif
 
 namespace s3d {
     namespace detail {
@@ -11,7 +21,13 @@ namespace s3d {
 		[[nodiscard]]
 		inline bool Contains(const Circle& c, const Vec2& p, const double tolerance = 1e-8)
 		{
-			const double dSquared = (c.center - p).lengthSq();
+			// FindFirstUncontained の各レーンと同じ演算順序になるよう、演算を文ごとに分けて計算する。
+			// 文をまたいだ FMA への縮約（GCC の既定の -ffp-contract=fast）は防げないため、ビット単位の一致は縮約を切ってビルドした場合に限る（Xcode プロジェクトでは -ffp-contract=off を指定している）。
+			const double dx = (c.center.x - p.x);
+			const double dy = (c.center.y - p.y);
+			const double dxSquared = (dx * dx);
+			const double dySquared = (dy * dy);
+			const double dSquared = (dxSquared + dySquared);
 			const double rSquared = (c.r * c.r);
 			const double err = Max(0.0, (dSquared - rSquared));
 
@@ -22,81 +38,1496 @@ namespace s3d {
 			
 			return (((err / rSquared) <= tolerance) || (err <= tolerance));
 		}
-    }
 
-    namespace Geometry2D {
-        
-        SIV3D_CONCEPT_URBG_
-		Circle SmallestEnclosingCircle(Array<Vec2> points, const double tolerance, URBG&& urbg)
+		/// @brief 円 inner が円 c に含まれているかを判定します。
+		/// @param c 外側の円
+		/// @param inner 内側の円
+		/// @param tolerance 許容誤差（inner が c からはみ出す距離について、c の半径に対する相対誤差または絶対誤差のいずれかが許容誤差以下であれば許容）
+		/// @return 円 inner が円 c に含まれている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		inline bool Contains(const Circle& c, const Circle& inner, const double tolerance = 1e-8)
 		{
-			if (points.size() == 0)
+			const double err = Max(0.0, (c.center.distanceFrom(inner.center) + inner.r - c.r));
+
+			if (c.r == 0)
 			{
-				return Circle{};
+				return (err <= tolerance);
 			}
 
-			if (points.size() == 1)
+			return (((err / c.r) <= tolerance) || (err <= tolerance));
+		}
+
+		/// @brief 点 p が球 s に含まれているかを判定します。
+		/// @param s 球
+		/// @param p 点
+		/// @param tolerance 許容誤差（相対誤差または絶対誤差のいずれかが許容誤差以下であれば許容）
+		/// @return 点 p が球 s に含まれている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		inline bool Contains(const Sphere& s, const Vec3& p, const double tolerance = 1e-8)
+		{
+			// FindFirstUncontained の各レーンと同じ演算順序になるよう、演算を文ごとに分けて計算する。
+			// 文をまたいだ FMA への縮約（GCC の既定の -ffp-contract=fast）は防げないため、ビット単位の一致は縮約を切ってビルドした場合に限る（Xcode プロジェクトでは -ffp-contract=off を指定している）。
+			const double dx = (s.center.x - p.x);
+			const double dy = (s.center.y - p.y);
+			const double dz = (s.center.z - p.z);
+			const double dxSquared = (dx * dx);
+			const double dySquared = (dy * dy);
+			const double dzSquared = (dz * dz);
+			const double dSquared = ((dxSquared + dySquared) + dzSquared);
+			const double rSquared = (s.r * s.r);
+			const double err = Max(0.0, (dSquared - rSquared));
+
+			if (rSquared == 0)
 			{
-				return Circle{ points[0], 0.0 };
+				return (err <= tolerance);
 			}
 
-			if (points.size() == 2)
+			return (((err / rSquared) <= tolerance) || (err <= tolerance));
+		}
+
+		/// @brief 円の中心と、円に含まれるとみなす点と中心の距離の 2 乗の上限の組です。
+		/// @remark 円が変わるたびに、判定方法（`Geometry2D::ContainmentPolicy`）から 1 回だけ求めます。
+		/// 点ごとの判定は、距離の 2 乗を求めて上限と 1 回比較するだけになり、除算や分岐を含みません。
+		struct ContainmentBound
+		{
+			Vec2 center;
+
+			double dSquaredMax;
+
+			/// @brief 点 p が円に含まれているかを判定します。
+			/// @param p 点
+			/// @return 点 p が円に含まれている場合 true, それ以外の場合は false
+			/// @remark 距離の 2 乗が NaN の場合は、Contains と同じく含まれているとみなします。
+			[[nodiscard]]
+			bool contains(const Vec2& p) const noexcept
 			{
-				return Circle{ points[0], points[1] };
+				// Contains と同じ演算順序になるよう、演算を文ごとに分けて計算する（FMA への縮約については Contains を参照）。
+				const double dx = (center.x - p.x);
+				const double dy = (center.y - p.y);
+				const double dxSquared = (dx * dx);
+				const double dySquared = (dy * dy);
+				const double dSquared = (dxSquared + dySquared);
+				return (not (dSquaredMax < dSquared));
 			}
+		};
+
+		/// @brief 円 c と判定方法 containment から、包含判定に使う ContainmentBound を求めます。
+		/// @tparam Containment 判定方法の型
+		/// @param c 円
+		/// @param containment 判定方法
+		/// @return 包含判定に使う円の中心と距離の 2 乗の上限
+		template <class Containment>
+		[[nodiscard]]
+		inline ContainmentBound MakeContainmentBound(const Circle& c, const Containment& containment)
+		{
+			return{ c.center, containment.threshold(c.r * c.r) };
+		}
 
-			if (points.size() == 3)
+		/// @brief 円 c と許容誤差 tolerance から、Contains と同じ判定を行う ContainmentBound を求めます。
+		/// @param c 円
+		/// @param tolerance 許容誤差（相対誤差または絶対誤差のいずれかが許容誤差以下であれば許容）
+		/// @return 包含判定に使う円の中心と距離の 2 乗の上限
+		[[nodiscard]]
+		inline ContainmentBound MakeContainmentBound(const Circle& c, const double tolerance)
+		{
+			return MakeContainmentBound(c, Geometry2D::CombinedTolerance{ tolerance });
+		}
+
+		/// @brief 球の中心と、球に含まれるとみなす点と中心の距離の 2 乗の上限の組です。
+		/// @remark ContainmentBound の 3 次元版です。判定方法の threshold(r²) は次元によらないため、2 次元と同じ判定方法を使えます。
+		struct SphereContainmentBound
+		{
+			Vec3 center;
+
+			double dSquaredMax;
+
+			/// @brief 点 p が球に含まれているかを判定します。
+			/// @param p 点
+			/// @return 点 p が球に含まれている場合 true, それ以外の場合は false
+			[[nodiscard]]
+			bool contains(const Vec3& p) const noexcept
 			{
-				return SmallestEnclosingCircle(points[0], points[1], points[2]);
+				// Contains と同じ演算順序になるよう、演算を文ごとに分けて計算する（FMA への縮約については Contains を参照）。
+				const double dx = (center.x - p.x);
+				const double dy = (center.y - p.y);
+				const double dz = (center.z - p.z);
+				const double dxSquared = (dx * dx);
+				const double dySquared = (dy * dy);
+				const double dzSquared = (dz * dz);
+				const double dSquared = ((dxSquared + dySquared) + dzSquared);
+				return (not (dSquaredMax < dSquared));
 			}
+		};
+
+		/// @brief 球 s と判定方法 containment から、包含判定に使う SphereContainmentBound を求めます。
+		/// @tparam Containment 判定方法の型
+		/// @param s 球
+		/// @param containment 判定方法
+		/// @return 包含判定に使う球の中心と距離の 2 乗の上限
+		template <class Containment>
+		[[nodiscard]]
+		inline SphereContainmentBound MakeContainmentBound(const Sphere& s, const Containment& containment)
+		{
+			return{ s.center, containment.threshold(s.r * s.r) };
+		}
+
+		/// @brief 倍精度浮動小数点数の丸め単位 2^-53
+		inline constexpr double RoundingUnit = (std::numeric_limits<double>::epsilon() / 2);
+
+		/// @brief Orientation の符号を、誤差のない多倍長の展開で求めます。
+		[[nodiscard]]
+		double OrientationExact(const Vec2& a, const Vec2& b, const Vec2& c);
 
-			if (points.size() == 4)
+		/// @brief InCircle の符号を、誤差のない多倍長の展開で求めます。
+		[[nodiscard]]
+		double InCircleExact(const Vec2& a, const Vec2& b, const Vec2& c, const Vec2& d);
+
+		/// @brief InDiametralCircle の符号を、誤差のない多倍長の展開で求めます。
+		[[nodiscard]]
+		double InDiametralCircleExact(const Vec2& a, const Vec2& b, const Vec2& p);
+
+		/// @brief 点 a, b, c が反時計回りに並んでいるか（y 軸が上向きの座標系で）を、符号が正確になるように判定します。
+		/// @param a 点 a
+		/// @param b 点 b
+		/// @param c 点 c
+		/// @return 反時計回りなら正、時計回りなら負、同一直線上にあれば 0
+		/// @remark 倍精度で計算した値の誤差の上界から符号が確定しない場合だけ、OrientationExact で計算し直します（Shewchuk の適応的述語）。
+		[[nodiscard]]
+		inline double Orientation(const Vec2& a, const Vec2& b, const Vec2& c)
+		{
+			const double detLeft = ((a.x - c.x) * (b.y - c.y));
+			const double detRight = ((a.y - c.y) * (b.x - c.x));
+			const double det = (detLeft - detRight);
+			const double errorBound = (((3.0 + (16.0 * RoundingUnit)) * RoundingUnit) * (Abs(detLeft) + Abs(detRight)));
+
+			if ((errorBound < det) || (det < -errorBound))
 			{
-				return SmallestEnclosingCircle(points[0], points[1], points[2], points[3], tolerance);
+				return det;
 			}
 
-			points.shuffle(std::forward<URBG>(urbg));
+			return OrientationExact(a, b, c);
+		}
+
+		/// @brief 点 d が、反時計回りに並んだ点 a, b, c を通る円の内部にあるかを、符号が正確になるように判定します。
+		/// @param a 点 a
+		/// @param b 点 b
+		/// @param c 点 c
+		/// @param d 点 d
+		/// @return 内部にあれば正、外部にあれば負、円周上にあれば 0（a, b, c が時計回りの場合は符号が反転します）
+		/// @remark 倍精度で計算した値の誤差の上界から符号が確定しない場合だけ、InCircleExact で計算し直します（Shewchuk の適応的述語）。
+		[[nodiscard]]
+		inline double InCircle(const Vec2& a, const Vec2& b, const Vec2& c, const Vec2& d)
+		{
+			const double adx = (a.x - d.x);
+			const double ady = (a.y - d.y);
+			const double bdx = (b.x - d.x);
+			const double bdy = (b.y - d.y);
+			const double cdx = (c.x - d.x);
+			const double cdy = (c.y - d.y);
+
+			const double bdxcdy = (bdx * cdy);
+			const double cdxbdy = (cdx * bdy);
+			const double aLift = ((adx * adx) + (ady * ady));
+
+			const double cdxady = (cdx * ady);
+			const double adxcdy = (adx * cdy);
+			const double bLift = ((bdx * bdx) + (bdy * bdy));
+
+			const double adxbdy = (adx * bdy);
+			const double bdxady = (bdx * ady);
+			const double cLift = ((cdx * cdx) + (cdy * cdy));
+
+			const double det = ((aLift * (bdxcdy - cdxbdy)) + (bLift * (cdxady - adxcdy)) + (cLift * (adxbdy - bdxady)));
+			const double permanent = (((Abs(bdxcdy) + Abs(cdxbdy)) * aLift) + ((Abs(cdxady) + Abs(adxcdy)) * bLift) + ((Abs(adxbdy) + Abs(bdxady)) * cLift));
+			const double errorBound = (((10.0 + (96.0 * RoundingUnit)) * RoundingUnit) * permanent);
 
-			// 適当な 1 点を含む最小包含円から始めて、少しずつ広げていく戦略を取る。
-			// 含まれない点があったら、それが境界上になるように新たに取り直す。
-			Circle circle{ points[0], 0.0 };
+			if ((errorBound < det) || (det < -errorBound))
+			{
+				return det;
+			}
+
+			return InCircleExact(a, b, c, d);
+		}
+
+		/// @brief 点 p が、線分 ab を直径とする円の内部にあるかを、符号が正確になるように判定します。
+		/// @param a 点 a
+		/// @param b 点 b
+		/// @param p 点 p
+		/// @return (p - a)・(p - b)。内部にあれば負、外部にあれば正、円周上にあれば 0
+		/// @remark 倍精度で計算した値の誤差の上界から符号が確定しない場合だけ、InDiametralCircleExact で計算し直します。
+		[[nodiscard]]
+		inline double InDiametralCircle(const Vec2& a, const Vec2& b, const Vec2& p)
+		{
+			const double dotX = ((p.x - a.x) * (p.x - b.x));
+			const double dotY = ((p.y - a.y) * (p.y - b.y));
+			const double det = (dotX + dotY);
+			const double errorBound = (((3.0 + (16.0 * RoundingUnit)) * RoundingUnit) * (Abs(dotX) + Abs(dotY)));
+
+			if ((errorBound < det) || (det < -errorBound))
+			{
+				return det;
+			}
+
+			return InDiametralCircleExact(a, b, p);
+		}
+
+		/// @brief 円を、その境界上にある 1 〜 3 個の入力点（支持点）で表します。
+		/// @remark 包含判定は支持点と入力の座標だけから符号が正確な述語で行うため、丸め誤差や許容誤差の影響を受けません。
+		struct SupportCircle
+		{
+			/// @brief 支持点。3 点の場合は反時計回りに並べます。
+			std::array<Vec2, 3> points;
+
+			/// @brief 支持点の個数
+			size_t count = 0;
+
+			/// @brief 点 p が円に含まれる（円周上を含む）かを返します。
+			[[nodiscard]]
+			bool contains(const Vec2& p) const
+			{
+				switch (count)
+				{
+				case 0:
+					return false;
+				case 1:
+					return (p == points[0]);
+				case 2:
+					return (InDiametralCircle(points[0], points[1], p) <= 0.0);
+				default:
+					return (0.0 <= InCircle(points[0], points[1], points[2], p));
+				}
+			}
+
+			/// @brief 円を倍精度の Circle で表します。
+			/// @return 円。半径は、計算した中心から最も遠い支持点までの距離です。
+			[[nodiscard]]
+			Circle asCircle() const;
+		};
+
+		/// @brief 点 p0, p1 を境界上に持ち、点 p2 を含む最小の円を支持点で表します。
+		/// @return p2 が p0, p1 を直径とする円の外部にある場合は、3 点を通る円
+		[[nodiscard]]
+		SupportCircle MakeSupportCircle(const Vec2& p0, const Vec2& p1, const Vec2& p2);
+
+		/// @brief 構造体配列ではなく x 座標・y 座標を別々の配列に格納した点群 (xs[i], ys[i]) のうち、添字が [first, last) の範囲で最初に円 c に含まれない点を探します。
+		/// @param xs 点群の x 座標
+		/// @param ys 点群の y 座標
+		/// @param first 探索を開始する添字
+		/// @param last 探索を終了する添字（この添字は含まない）
+		/// @param bound 円の中心と、円に含まれるとみなす距離の 2 乗の上限
+		/// @return 最初に円に含まれない点の添字。すべての点が含まれている場合は last
+		/// @remark AVX2 / SSE2 / NEON が使える環境では 4 点または 2 点ずつまとめて判定します。各レーンは ContainmentBound::contains と同じ演算を同じ順序で行うため、FMA への縮約を切ってビルドした場合は判定結果がスカラー版と一致します（縮約される場合は、境界上の点で最下位ビットの差により判定が分かれることがあります）。
+		[[nodiscard]]
+		inline size_t FindFirstUncontained(const double* xs, const double* ys, size_t first, const size_t last, const ContainmentBound& bound)
+		{
+			// 距離の 2 乗が NaN のレーンは、順序付きの比較が偽になるため含まれているとみなされ、スカラー版と同じ結果になる。
+		# if defined(__AVX2__)
 
-			for (size_t i = 1; i < points.size(); ++i)
 			{
-				const Vec2& p0 = points[i];
+				const __m256d cx = _mm256_set1_pd(bound.center.x);
+				const __m256d cy = _mm256_set1_pd(bound.center.y);
+				const __m256d d2Max = _mm256_set1_pd(bound.dSquaredMax);
 
-				if (not detail::Contains(circle, p0, tolerance))
+				for (; (first + 4) <= last; first += 4)
 				{
-					circle = Circle{ p0, 0.0 };
+					const __m256d dx = _mm256_sub_pd(cx, _mm256_loadu_pd(xs + first));
+					const __m256d dy = _mm256_sub_pd(cy, _mm256_loadu_pd(ys + first));
+					const __m256d d2 = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+					const int mask = _mm256_movemask_pd(_mm256_cmp_pd(d2Max, d2, _CMP_LT_OQ));
 
-					for (size_t j = 0; j < i; ++j)
+					if (mask != 0)
 					{
-						const Vec2& p1 = points[j];
-						
-						if (not detail::Contains(circle, p1, tolerance))
-						{
-							circle = Circle{ p0, p1 };
-
-							for (size_t k = 0; k < j; ++k)
-							{
-								const Vec2& p2 = points[k];
-								
-								if (not detail::Contains(circle, p2, tolerance))
-								{
-									circle = Triangle(p0, p1, p2).getCircumscribedCircle();
-								}
-							}
-						}
+						return (first + std::countr_zero(static_cast<unsigned>(mask)));
 					}
 				}
 			}
 
-			return circle;
+		# elif defined(__SSE2__) || defined(_M_X64)
+
+			{
+				const __m128d cx = _mm_set1_pd(bound.center.x);
+				const __m128d cy = _mm_set1_pd(bound.center.y);
+				const __m128d d2Max = _mm_set1_pd(bound.dSquaredMax);
+
+				for (; (first + 2) <= last; first += 2)
+				{
+					const __m128d dx = _mm_sub_pd(cx, _mm_loadu_pd(xs + first));
+					const __m128d dy = _mm_sub_pd(cy, _mm_loadu_pd(ys + first));
+					const __m128d d2 = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+					const int mask = _mm_movemask_pd(_mm_cmplt_pd(d2Max, d2));
+
+					if (mask != 0)
+					{
+						return (first + std::countr_zero(static_cast<unsigned>(mask)));
+					}
+				}
+			}
+
+		# elif defined(__ARM_NEON)
+
+			{
+				const float64x2_t cx = vdupq_n_f64(bound.center.x);
+				const float64x2_t cy = vdupq_n_f64(bound.center.y);
+				const float64x2_t d2Max = vdupq_n_f64(bound.dSquaredMax);
+
+				for (; (first + 2) <= last; first += 2)
+				{
+					const float64x2_t dx = vsubq_f64(cx, vld1q_f64(xs + first));
+					const float64x2_t dy = vsubq_f64(cy, vld1q_f64(ys + first));
+					const float64x2_t d2 = vaddq_f64(vmulq_f64(dx, dx), vmulq_f64(dy, dy));
+					const uint64x2_t outside = vcltq_f64(d2Max, d2);
+
+					if (vgetq_lane_u64(outside, 0) != 0)
+					{
+						return first;
+					}
+
+					if (vgetq_lane_u64(outside, 1) != 0)
+					{
+						return (first + 1);
+					}
+				}
+			}
+
+		# endif
+
+			for (; first < last; ++first)
+			{
+				if (not bound.contains(Vec2{ xs[first], ys[first] }))
+				{
+					return first;
+				}
+			}
+
+			return last;
 		}
 
-		SIV3D_CONCEPT_URBG_
-		Circle SmallestEnclosingCircle(Array<Vec2> points, URBG&& urbg, double tolerance)
+		/// @brief 連続した点群 points[i] のうち、添字が [first, last) の範囲で最初に円 c に含まれない点を探します。
+		/// @tparam PointType 点の型（Vec2 または Float2）
+		/// @param points 点群の先頭を指すポインタ
+		/// @param first 探索を開始する添字
+		/// @param last 探索を終了する添字（この添字は含まない）
+		/// @param bound 円の中心と、円に含まれるとみなす距離の 2 乗の上限
+		/// @return 最初に円に含まれない点の添字。すべての点が含まれている場合は last
+		/// @remark 構造体配列のまま読み込み、レジスタ上で x 座標と y 座標に並べ替えてから判定します。
+		/// Float2 の点群は読み込んだ直後に double に変換し（この変換は誤差を生じません）、以降は Vec2 と同じ演算で判定します。
+		template <class PointType>
+		[[nodiscard]]
+		inline size_t FindFirstUncontained(const PointType* points, size_t first, const size_t last, const ContainmentBound& bound)
 		{
-			return SmallestEnclosingCircle(std::move(points), tolerance, std::forward<URBG>(urbg));
+			static_assert(std::is_same_v<PointType, Vec2> || std::is_same_v<PointType, Float2>);
+			constexpr bool IsFloat = std::is_same_v<PointType, Float2>;
+			using Scalar = typename PointType::value_type;
+
+			const Scalar* const data = &points[0].x;
+
+		# if defined(__AVX2__)
+
+			{
+				const __m256d cx = _mm256_set1_pd(bound.center.x);
+				const __m256d cy = _mm256_set1_pd(bound.center.y);
+				const __m256d d2Max = _mm256_set1_pd(bound.dSquaredMax);
+
+				for (; (first + 4) <= last; first += 4)
+				{
+					// (x0, y0, x1, y1), (x2, y2, x3, y3) -> (x0, x2, x1, x3), (y0, y2, y1, y3) -> (x0, x1, x2, x3), (y0, y1, y2, y3)
+					__m256d v0, v1;
+
+					if constexpr (IsFloat)
+					{
+						const __m256 v = _mm256_loadu_ps(data + (first * 2));
+						v0 = _mm256_cvtps_pd(_mm256_castps256_ps128(v));
+						v1 = _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));
+					}
+					else
+					{
+						v0 = _mm256_loadu_pd(data + (first * 2));
+						v1 = _mm256_loadu_pd(data + (first * 2) + 4);
+					}
+
+					const __m256d x = _mm256_permute4x64_pd(_mm256_unpacklo_pd(v0, v1), 0b11'01'10'00);
+					const __m256d y = _mm256_permute4x64_pd(_mm256_unpackhi_pd(v0, v1), 0b11'01'10'00);
+					const __m256d dx = _mm256_sub_pd(cx, x);
+					const __m256d dy = _mm256_sub_pd(cy, y);
+					const __m256d d2 = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+					const int mask = _mm256_movemask_pd(_mm256_cmp_pd(d2Max, d2, _CMP_LT_OQ));
+
+					if (mask != 0)
+					{
+						return (first + std::countr_zero(static_cast<unsigned>(mask)));
+					}
+				}
+			}
+
+		# elif defined(__SSE2__) || defined(_M_X64)
+
+			{
+				const __m128d cx = _mm_set1_pd(bound.center.x);
+				const __m128d cy = _mm_set1_pd(bound.center.y);
+				const __m128d d2Max = _mm_set1_pd(bound.dSquaredMax);
+
+				for (; (first + 2) <= last; first += 2)
+				{
+					__m128d v0, v1;
+
+					if constexpr (IsFloat)
+					{
+						const __m128 v = _mm_loadu_ps(data + (first * 2));
+						v0 = _mm_cvtps_pd(v);
+						v1 = _mm_cvtps_pd(_mm_movehl_ps(v, v));
+					}
+					else
+					{
+						v0 = _mm_loadu_pd(data + (first * 2));
+						v1 = _mm_loadu_pd(data + (first * 2) + 2);
+					}
+
+					const __m128d dx = _mm_sub_pd(cx, _mm_unpacklo_pd(v0, v1));
+					const __m128d dy = _mm_sub_pd(cy, _mm_unpackhi_pd(v0, v1));
+					const __m128d d2 = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+					const int mask = _mm_movemask_pd(_mm_cmplt_pd(d2Max, d2));
+
+					if (mask != 0)
+					{
+						return (first + std::countr_zero(static_cast<unsigned>(mask)));
+					}
+				}
+			}
+
+		# elif defined(__ARM_NEON)
+
+			{
+				const float64x2_t cx = vdupq_n_f64(bound.center.x);
+				const float64x2_t cy = vdupq_n_f64(bound.center.y);
+				const float64x2_t d2Max = vdupq_n_f64(bound.dSquaredMax);
+
+				for (; (first + 2) <= last; first += 2)
+				{
+					// vld2q_f64 / vld2_f32 は (x0, y0, x1, y1) を (x0, x1), (y0, y1) に分けて読み込む。
+					float64x2_t x, y;
+
+					if constexpr (IsFloat)
+					{
+						const float32x2x2_t v = vld2_f32(data + (first * 2));
+						x = vcvt_f64_f32(v.val[0]);
+						y = vcvt_f64_f32(v.val[1]);
+					}
+					else
+					{
+						const float64x2x2_t v = vld2q_f64(data + (first * 2));
+						x = v.val[0];
+						y = v.val[1];
+					}
+
+					const float64x2_t dx = vsubq_f64(cx, x);
+					const float64x2_t dy = vsubq_f64(cy, y);
+					const float64x2_t d2 = vaddq_f64(vmulq_f64(dx, dx), vmulq_f64(dy, dy));
+					const uint64x2_t outside = vcltq_f64(d2Max, d2);
+
+					if (vgetq_lane_u64(outside, 0) != 0)
+					{
+						return first;
+					}
+
+					if (vgetq_lane_u64(outside, 1) != 0)
+					{
+						return (first + 1);
+					}
+				}
+			}
+
+		# endif
+
+			for (; first < last; ++first)
+			{
+				if (not bound.contains(Vec2{ points[first].x, points[first].y }))
+				{
+					return first;
+				}
+			}
+
+			return last;
 		}
-    }
+
+		/// @brief x 座標・y 座標を別々の配列に格納した点群を参照します。
+		struct SeparatedPointsView
+		{
+			const double* xs;
+
+			const double* ys;
+
+			[[nodiscard]]
+			Vec2 operator [](const size_t i) const noexcept
+			{
+				return{ xs[i], ys[i] };
+			}
+
+			[[nodiscard]]
+			size_t findFirstUncontained(const size_t first, const size_t last, const ContainmentBound& bound) const
+			{
+				return FindFirstUncontained(xs, ys, first, last, bound);
+			}
+		};
+
+		/// @brief 連続した Vec2 または Float2 の配列を参照します。
+		/// @tparam PointType 点の型
+		template <class PointType>
+		struct ContiguousPointsView
+		{
+			const PointType* points;
+
+			[[nodiscard]]
+			Vec2 operator [](const size_t i) const noexcept
+			{
+				return{ points[i].x, points[i].y };
+			}
+
+			[[nodiscard]]
+			size_t findFirstUncontained(const size_t first, const size_t last, const ContainmentBound& bound) const
+			{
+				return FindFirstUncontained(points, first, last, bound);
+			}
+		};
+
+		/// @brief 添字の配列 indices を通して、Vec2 または Float2 の点群 points[indices[i]] を参照します。
+		/// @tparam PointType 点の型
+		template <class PointType>
+		struct IndexedPointsView
+		{
+			const PointType* points;
+
+			const uint32* indices;
+
+			[[nodiscard]]
+			Vec2 operator [](const size_t i) const noexcept
+			{
+				const PointType& p = points[indices[i]];
+				return{ p.x, p.y };
+			}
+
+			[[nodiscard]]
+			size_t findFirstUncontained(size_t first, const size_t last, const ContainmentBound& bound) const
+			{
+				// 添字を介したランダムアクセスが支配的なため、スカラー版で判定しつつ、少し先の点を先読みしておく。
+				constexpr size_t PrefetchDistance = 16;
+
+				for (; first < last; ++first)
+				{
+				# if defined(__GNUC__) || defined(__clang__)
+					if ((first + PrefetchDistance) < last)
+					{
+						__builtin_prefetch(points + indices[first + PrefetchDistance]);
+					}
+				# endif
+
+					if (not bound.contains((*this)[first]))
+					{
+						return first;
+					}
+				}
+
+				return last;
+			}
+		};
+
+		template <class PointType>
+		ContiguousPointsView(const PointType*) -> ContiguousPointsView<PointType>;
+
+		template <class PointType>
+		IndexedPointsView(const PointType*, const uint32*) -> IndexedPointsView<PointType>;
+
+		/// @brief 頂点の番号の配列 indices を通して、長方形の頂点 rects[indices[i] / 4].point(indices[i] % 4) を参照します。
+		struct RectVerticesView
+		{
+			const RectF* rects;
+
+			const uint32* indices;
+
+			[[nodiscard]]
+			Vec2 operator [](const size_t i) const noexcept
+			{
+				return rects[indices[i] / 4].point(indices[i] % 4);
+			}
+
+			[[nodiscard]]
+			size_t findFirstUncontained(size_t first, const size_t last, const ContainmentBound& bound) const
+			{
+				for (; first < last; ++first)
+				{
+					if (not bound.contains((*this)[first]))
+					{
+						return first;
+					}
+				}
+
+				return last;
+			}
+		};
+
+		/// @brief x 座標・y 座標・z 座標を別々の配列に格納した 3 次元の点群のうち、添字が [first, last) の範囲で最初に球に含まれない点を探します。
+		/// @param xs 点群の x 座標
+		/// @param ys 点群の y 座標
+		/// @param zs 点群の z 座標
+		/// @param first 探索を開始する添字
+		/// @param last 探索を終了する添字（この添字は含まない）
+		/// @param bound 球の中心と、球に含まれるとみなす距離の 2 乗の上限
+		/// @return 最初に球に含まれない点の添字。すべての点が含まれている場合は last
+		/// @remark 2 次元の FindFirstUncontained と同じく、各レーンは SphereContainmentBound::contains と同じ演算を同じ順序で行います。
+		[[nodiscard]]
+		inline size_t FindFirstUncontained(const double* xs, const double* ys, const double* zs, size_t first, const size_t last, const SphereContainmentBound& bound)
+		{
+		# if defined(__AVX2__)
+
+			{
+				const __m256d cx = _mm256_set1_pd(bound.center.x);
+				const __m256d cy = _mm256_set1_pd(bound.center.y);
+				const __m256d cz = _mm256_set1_pd(bound.center.z);
+				const __m256d d2Max = _mm256_set1_pd(bound.dSquaredMax);
+
+				for (; (first + 4) <= last; first += 4)
+				{
+					const __m256d dx = _mm256_sub_pd(cx, _mm256_loadu_pd(xs + first));
+					const __m256d dy = _mm256_sub_pd(cy, _mm256_loadu_pd(ys + first));
+					const __m256d dz = _mm256_sub_pd(cz, _mm256_loadu_pd(zs + first));
+					const __m256d d2 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)), _mm256_mul_pd(dz, dz));
+					const int mask = _mm256_movemask_pd(_mm256_cmp_pd(d2Max, d2, _CMP_LT_OQ));
+
+					if (mask != 0)
+					{
+						return (first + std::countr_zero(static_cast<unsigned>(mask)));
+					}
+				}
+			}
+
+		# elif defined(__SSE2__) || defined(_M_X64)
+
+			{
+				const __m128d cx = _mm_set1_pd(bound.center.x);
+				const __m128d cy = _mm_set1_pd(bound.center.y);
+				const __m128d cz = _mm_set1_pd(bound.center.z);
+				const __m128d d2Max = _mm_set1_pd(bound.dSquaredMax);
+
+				for (; (first + 2) <= last; first += 2)
+				{
+					const __m128d dx = _mm_sub_pd(cx, _mm_loadu_pd(xs + first));
+					const __m128d dy = _mm_sub_pd(cy, _mm_loadu_pd(ys + first));
+					const __m128d dz = _mm_sub_pd(cz, _mm_loadu_pd(zs + first));
+					const __m128d d2 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)), _mm_mul_pd(dz, dz));
+					const int mask = _mm_movemask_pd(_mm_cmplt_pd(d2Max, d2));
+
+					if (mask != 0)
+					{
+						return (first + std::countr_zero(static_cast<unsigned>(mask)));
+					}
+				}
+			}
+
+		# elif defined(__ARM_NEON)
+
+			{
+				const float64x2_t cx = vdupq_n_f64(bound.center.x);
+				const float64x2_t cy = vdupq_n_f64(bound.center.y);
+				const float64x2_t cz = vdupq_n_f64(bound.center.z);
+				const float64x2_t d2Max = vdupq_n_f64(bound.dSquaredMax);
+
+				for (; (first + 2) <= last; first += 2)
+				{
+					const float64x2_t dx = vsubq_f64(cx, vld1q_f64(xs + first));
+					const float64x2_t dy = vsubq_f64(cy, vld1q_f64(ys + first));
+					const float64x2_t dz = vsubq_f64(cz, vld1q_f64(zs + first));
+					const float64x2_t d2 = vaddq_f64(vaddq_f64(vmulq_f64(dx, dx), vmulq_f64(dy, dy)), vmulq_f64(dz, dz));
+					const uint64x2_t outside = vcltq_f64(d2Max, d2);
+
+					if (vgetq_lane_u64(outside, 0) != 0)
+					{
+						return first;
+					}
+
+					if (vgetq_lane_u64(outside, 1) != 0)
+					{
+						return (first + 1);
+					}
+				}
+			}
+
+		# endif
+
+			for (; first < last; ++first)
+			{
+				if (not bound.contains(Vec3{ xs[first], ys[first], zs[first] }))
+				{
+					return first;
+				}
+			}
+
+			return last;
+		}
+
+		/// @brief x 座標・y 座標・z 座標を別々の配列に格納した 3 次元の点群を参照します。
+		struct SeparatedPoints3DView
+		{
+			const double* xs;
+
+			const double* ys;
+
+			const double* zs;
+
+			[[nodiscard]]
+			Vec3 operator [](const size_t i) const noexcept
+			{
+				return{ xs[i], ys[i], zs[i] };
+			}
+
+			[[nodiscard]]
+			size_t findFirstUncontained(const size_t first, const size_t last, const SphereContainmentBound& bound) const
+			{
+				return FindFirstUncontained(xs, ys, zs, first, last, bound);
+			}
+		};
+
+		/// @brief 8 方向の極値点からなる八角形（Akl–Toussaint のヒューリスティック）の厳密に内部にある点を、点群 points から取り除きます。
+		/// @param points 点群（1 点以上）。内部の点が取り除かれ、残った点の順序は保たれます。
+		/// @remark 凸包の内部にある点は最小包含円の境界上に来ないため、取り除いても最小包含円は変わりません。
+		void RemoveInteriorPoints(Array<Vec2>& points);
+
+		/// @brief 点群 points の凸包の頂点を返します。
+		/// @param points 点群
+		/// @return 凸包の頂点。すべての点が同一直線上にある場合は両端の 2 点（同一点の場合は同じ点 2 つ）
+		[[nodiscard]]
+		Array<Vec2> ConvexHullVertices(const Array<Vec2>& points);
+
+		/// @brief 点群のうち円に含まれない点を、複数のスレッドで分担して繰り返し探すためのクラスです。
+		/// @remark ワーカースレッドは構築時に 1 度だけ起動し、appendUncontained の呼び出しごとに使い回します。
+		/// 呼び出したスレッドも 1 つ目の区間を受け持ちます。
+		class UncontainedScanner
+		{
+		public:
+
+			/// @brief 点群 points を threadCount 個のスレッドで分担して探すための準備をします。
+			/// @param points 点群。このオブジェクトが破棄されるまで有効である必要があります。
+			/// @param threadCount 使用するスレッド数（1 以上）
+			UncontainedScanner(std::span<const Vec2> points, size_t threadCount);
+
+			/// @brief ワーカースレッドを終了させ、合流します。
+			~UncontainedScanner();
+
+			UncontainedScanner(const UncontainedScanner&) = delete;
+
+			UncontainedScanner& operator =(const UncontainedScanner&) = delete;
+
+			/// @brief 点群のうち円 c に含まれない点を探し、working の末尾に追加します。
+			/// @param c 円
+			/// @param tolerance 許容誤差（相対誤差または絶対誤差のいずれかが許容誤差以下であれば許容）
+			/// @param working 円に含まれない点の追加先
+			/// @return 追加した点の個数
+			size_t appendUncontained(const Circle& c, double tolerance, Array<Vec2>& working);
+
+		private:
+
+			struct State;
+
+			std::unique_ptr<State> m_state;
+		};
+
+		/// @brief 4 点以下の点群 points[0], ..., points[n - 1] の最小包含円を返します。
+		/// @tparam PointsView 点群を参照する型
+		/// @param points 点群
+		/// @param n 点の個数（4 以下）
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差
+		/// @return 点群の最小包含円
+		template <class PointsView>
+		[[nodiscard]]
+		Circle SmallestEnclosingCircleFew(const PointsView& points, const size_t n, const double tolerance)
+		{
+			switch (n)
+			{
+			case 0:
+				return Circle{};
+			case 1:
+				return Circle{ points[0], 0.0 };
+			case 2:
+				return Circle{ points[0], points[1] };
+			case 3:
+				return Geometry2D::SmallestEnclosingCircle(points[0], points[1], points[2]);
+			default:
+				return Geometry2D::SmallestEnclosingCircle(points[0], points[1], points[2], points[3], tolerance);
+			}
+		}
+
+		/// @brief 4 点以下の点群 points[0], ..., points[n - 1] の最小包含円を、判定方法 containment を使って返します。
+		/// @tparam PointsView 点群を参照する型
+		/// @tparam Containment 判定方法の型
+		/// @param points 点群
+		/// @param n 点の個数（4 以下）
+		/// @param containment 点が円に含まれているかの判定方法
+		/// @return 点群の最小包含円
+		/// @remark 4 点の場合は、その判定方法で GrowEnclosingCircle と同じ手順を行います。
+		template <class PointsView, class Containment>
+		[[nodiscard]]
+		Circle SmallestEnclosingCircleFew(const PointsView& points, const size_t n, const Containment& containment);
+
+		/// @brief 4 点以下の点群 points[0], ..., points[n - 1] の最小包含円を返します。
+		/// @remark CombinedTolerance は double の許容誤差と同じ判定なので、4 点の場合も既存の結果と一致するよう同じ方法で求めます。
+		template <class PointsView>
+		[[nodiscard]]
+		Circle SmallestEnclosingCircleFew(const PointsView& points, const size_t n, const Geometry2D::CombinedTolerance& containment)
+		{
+			return SmallestEnclosingCircleFew(points, n, containment.tolerance);
+		}
+
+		/// @brief 点群 points のうち、x 座標・y 座標がそれぞれ最小・最大の点を先頭の 4 要素に移動します。
+		/// @tparam PointType 点の型
+		/// @param points 点群（4 点以上）
+		/// @remark 最初の円が最終的な円に近くなり、円を取り直す回数が減ります。残りの点の順序が無作為であれば、期待計算量は変わりません。
+		template <class PointType>
+		inline void MoveAxisExtremesToFront(const std::span<PointType> points)
+		{
+			const auto less = std::array<bool(*)(const PointType&, const PointType&), 4>{
+				[](const PointType& a, const PointType& b) { return (a.x < b.x); },
+				[](const PointType& a, const PointType& b) { return (b.x < a.x); },
+				[](const PointType& a, const PointType& b) { return (a.y < b.y); },
+				[](const PointType& a, const PointType& b) { return (b.y < a.y); },
+			};
+
+			for (size_t k = 0; k < less.size(); ++k)
+			{
+				std::iter_swap((points.begin() + k), std::min_element((points.begin() + k), points.end(), less[k]));
+			}
+		}
+
+		/// @brief 統計を記録しない場合に使う記録方法です。
+		/// @remark すべての関数が何もしないため、インライン展開の後に記録の処理は残りません。
+		struct NoStatsRecorder
+		{
+			void countContainsTests(size_t) const noexcept {}
+
+			template <size_t Level>
+			void countRebuild() const noexcept {}
+
+			template <class Fun>
+			void timeShuffle(Fun&& fun) const
+			{
+				std::forward<Fun>(fun)();
+			}
+		};
+
+		/// @brief 統計を SmallestEnclosingCircleStats に記録する記録方法です。
+		struct StatsRecorder
+		{
+			Geometry2D::SmallestEnclosingCircleStats& stats;
+
+			void countContainsTests(const size_t count) const noexcept
+			{
+				stats.containsTests += count;
+			}
+
+			/// @tparam Level ループの深さ（0: 最も外側, 1: 2 重目, 2: 最も内側）
+			/// @remark SmallestEnclosingCircleStats は 2 次元の 3 重ループの分しか数えないため、3 次元（4 重ループ）では使えません。
+			template <size_t Level>
+			void countRebuild() const noexcept
+			{
+				static_assert((Level < 3), "StatsRecorder only counts the three loops of the 2D solver");
+
+				if constexpr (Level == 0)
+				{
+					++stats.outerRebuilds;
+				}
+				else if constexpr (Level == 1)
+				{
+					++stats.middleRebuilds;
+				}
+				else
+				{
+					++stats.innerRebuilds;
+				}
+			}
+
+			template <class Fun>
+			void timeShuffle(Fun&& fun) const
+			{
+				const auto start = std::chrono::steady_clock::now();
+				std::forward<Fun>(fun)();
+				stats.shuffleSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			}
+		};
+
+		/// @brief 3 点 p0, p1, p2 を通る球のうち最小のもの（3 点の外接円を大円とする球）を返します。
+		/// @return 3 点を通る最小の球。3 点が同一直線上にある場合は、最も離れた 2 点を直径の両端とする球
+		[[nodiscard]]
+		Sphere CircumscribedSphere(const Vec3& p0, const Vec3& p1, const Vec3& p2);
+
+		/// @brief 4 点 p0, p1, p2, p3 を通る球（外接球）を返します。
+		/// @return 4 点の外接球。4 点が同一平面上にある場合は、3 点を通る最小の球のうち最大のもの
+		[[nodiscard]]
+		Sphere CircumscribedSphere(const Vec3& p0, const Vec3& p1, const Vec3& p2, const Vec3& p3);
+
+		/// @brief Dim 次元の最小包含球を求めるときに使う型と、境界上の点（支持点）から球を作る関数をまとめたものです。
+		/// @tparam Dim 次元（2 または 3）
+		template <size_t Dim>
+		struct BallTraits;
+
+		template <>
+		struct BallTraits<2>
+		{
+			using Point = Vec2;
+
+			using Ball = Circle;
+
+			/// @brief 支持点 support[0], ..., support[Count - 1] を境界上に持つ最小の円を返します。
+			template <size_t Count>
+			[[nodiscard]]
+			static Circle FromSupport(const std::array<Vec2, 3>& support)
+			{
+				if constexpr (Count == 1)
+				{
+					return Circle{ support[0], 0.0 };
+				}
+				else if constexpr (Count == 2)
+				{
+					return Circle{ support[0], support[1] };
+				}
+				else
+				{
+					static_assert(Count == 3);
+					return Triangle(support[0], support[1], support[2]).getCircumscribedCircle();
+				}
+			}
+		};
+
+		template <>
+		struct BallTraits<3>
+		{
+			using Point = Vec3;
+
+			using Ball = Sphere;
+
+			/// @brief 支持点 support[0], ..., support[Count - 1] を境界上に持つ最小の球を返します。
+			template <size_t Count>
+			[[nodiscard]]
+			static Sphere FromSupport(const std::array<Vec3, 4>& support)
+			{
+				if constexpr (Count == 1)
+				{
+					return Sphere{ support[0], 0.0 };
+				}
+				else if constexpr (Count == 2)
+				{
+					return Sphere{ ((support[0] + support[1]) * 0.5), (support[0].distanceFrom(support[1]) * 0.5) };
+				}
+				else if constexpr (Count == 3)
+				{
+					return CircumscribedSphere(support[0], support[1], support[2]);
+				}
+				else
+				{
+					static_assert(Count == 4);
+					return CircumscribedSphere(support[0], support[1], support[2], support[3]);
+				}
+			}
+		};
+
+		/// @brief シャッフル済みの点群の最小包含球を、先頭から順に球を広げていくことで求める処理の状態です。
+		/// @tparam Dim 次元（2 または 3）
+		/// @tparam PointsView 点群を参照する型
+		/// @tparam Containment 判定方法の型
+		/// @tparam Recorder 統計の記録方法（NoStatsRecorder または StatsRecorder）
+		/// @remark ループの深さ（境界上に固定した点の個数）をテンプレート引数にして、Dim + 1 重のループをコンパイル時に展開します。
+		/// 2 次元では、展開後のループが 3 重ループを直接書いた場合と同じになります。
+		template <size_t Dim, class PointsView, class Containment, class Recorder>
+		struct BallGrower
+		{
+			using Traits = BallTraits<Dim>;
+
+			using Point = typename Traits::Point;
+
+			using Ball = typename Traits::Ball;
+
+			using Bound = decltype(MakeContainmentBound(std::declval<const Ball&>(), std::declval<const Containment&>()));
+
+			const PointsView& points;
+
+			const Containment& containment;
+
+			const Recorder& recorder;
+
+			Ball ball{};
+
+			Bound bound{};
+
+			/// @brief 現在の球の境界上に固定した点
+			std::array<Point, (Dim + 1)> support{};
+
+			/// @brief support[k] の、点群 points での添字
+			std::array<size_t, (Dim + 1)> supportPositions{};
+
+			/// @brief 現在の球を定めている支持点の個数。球は support[0], ..., support[supportCount - 1] で定まります。
+			size_t supportCount = 0;
+
+			// 球を取り直すたびに判定の上限を求め直し、点ごとの判定は上限との比較だけにする。
+			void setBall(const Ball& b)
+			{
+				ball = b;
+				bound = MakeContainmentBound(b, containment);
+			}
+
+			// 判定した点の個数は、見つかった点（見つからなければ last の手前）までの個数として数える。
+			[[nodiscard]]
+			size_t findFirstUncontained(const size_t first, const size_t last) const
+			{
+				const size_t i = points.findFirstUncontained(first, last, bound);
+				recorder.countContainsTests(Min((i + 1), last) - first);
+				return i;
+			}
+
+			/// @brief support[0], ..., support[Count - 1] を境界上に保ったまま、points[first], ..., points[last - 1] を含むまで球を広げます。
+			/// @tparam Count 境界上に固定した点の個数（Dim 以下）
+			template <size_t Count>
+			void grow(const size_t first, const size_t last)
+			{
+				// 含まれない点があったら、それが境界上になるように新たに取り直し、それより前の点を含むまで 1 段深いループで広げる。
+				for (size_t i = findFirstUncontained(first, last); i < last;
+					i = findFirstUncontained((i + 1), last))
+				{
+					support[Count] = points[i];
+					supportPositions[Count] = i;
+					supportCount = (Count + 1);
+					setBall(Traits::template FromSupport<(Count + 1)>(support));
+					recorder.template countRebuild<Count>();
+
+					if constexpr ((Count + 1) < (Dim + 1))
+					{
+						grow<(Count + 1)>(0, i);
+					}
+				}
+			}
+
+			/// @brief points[0] だけを含む球から始めて、points[0], ..., points[n - 1] の最小包含球を求めます。
+			/// @param n 点の個数（1 以上）
+			void run(const size_t n)
+			{
+				// 適当な 1 点を含む最小包含球から始めて、少しずつ広げていく戦略を取る。
+				support[0] = points[0];
+				supportPositions[0] = 0;
+				supportCount = 1;
+				setBall(Traits::template FromSupport<1>(support));
+				grow<0>(1, n);
+			}
+		};
+
+		/// @brief シャッフル済みの点群 points[0], ..., points[n - 1] の Dim 次元の最小包含球を、先頭から順に球を広げていくことで求めます。
+		/// @tparam Dim 次元（2 または 3）
+		/// @tparam PointsView 点群を参照する型
+		/// @tparam Containment 判定方法の型
+		/// @tparam Recorder 統計の記録方法（NoStatsRecorder または StatsRecorder）
+		/// @param points 点群
+		/// @param n 点の個数（1 以上）
+		/// @param containment 点が球に含まれているかの判定方法
+		/// @param recorder 統計の記録先
+		/// @return 点群の最小包含球（2 次元では Circle, 3 次元では Sphere）
+		template <size_t Dim, class PointsView, class Containment, class Recorder>
+		[[nodiscard]]
+		auto GrowEnclosingBall(const PointsView& points, const size_t n, const Containment& containment, const Recorder& recorder)
+		{
+			BallGrower<Dim, PointsView, Containment, Recorder> grower{ points, containment, recorder };
+			grower.run(n);
+			return grower.ball;
+		}
+
+		/// @brief シャッフル済みの点群 points[0], ..., points[n - 1] の最小包含円を、先頭から順に円を広げていくことで求めます。
+		/// @tparam PointsView 点群を参照する型
+		/// @tparam Containment 判定方法の型
+		/// @tparam Recorder 統計の記録方法（NoStatsRecorder または StatsRecorder）
+		/// @param points 点群
+		/// @param n 点の個数（1 以上）
+		/// @param containment 点が円に含まれているかの判定方法
+		/// @param recorder 統計の記録先
+		/// @return 点群の最小包含円
+		template <class PointsView, class Containment, class Recorder>
+		[[nodiscard]]
+		Circle GrowEnclosingCircle(const PointsView& points, const size_t n, const Containment& containment, const Recorder& recorder)
+		{
+			return GrowEnclosingBall<2>(points, n, containment, recorder);
+		}
+
+		/// @brief シャッフル済みの点群 points[0], ..., points[n - 1] の最小包含円を、先頭から順に円を広げていくことで求めます。
+		/// @tparam PointsView 点群を参照する型
+		/// @param points 点群
+		/// @param n 点の個数（1 以上）
+		/// @param tolerance 点が円に含まれているかの判定時の許容誤差
+		/// @return 点群の最小包含円
+		template <class PointsView>
+		[[nodiscard]]
+		Circle GrowEnclosingCircle(const PointsView& points, const size_t n, const double tolerance)
+		{
+			return GrowEnclosingCircle(points, n, Geometry2D::CombinedTolerance{ tolerance }, NoStatsRecorder{});
+		}
+
+		template <class PointsView, class Containment>
+		[[nodiscard]]
+		Circle SmallestEnclosingCircleFew(const PointsView& points, const size_t n, const Containment& containment)
+		{
+			if (n <= 3)
+			{
+				return SmallestEnclosingCircleFew(points, n, 0.0);
+			}
+
+			return GrowEnclosingCircle(points, n, containment, NoStatsRecorder{});
+		}
+
+		/// @brief シャッフル済みの点群 points[0], ..., points[n - 1] の最小包含円を、許容誤差を使わずに求めます。
+		/// @tparam PointsView 点群を参照する型
+		/// @param points 点群
+		/// @param n 点の個数（1 以上）
+		/// @return 点群の最小包含円の支持点
+		/// @remark GrowEnclosingCircle と同じ手順で、包含判定に SupportCircle::contains を使います。
+		template <class PointsView>
+		[[nodiscard]]
+		SupportCircle GrowEnclosingCircleRobust(const PointsView& points, const size_t n)
+		{
+			SupportCircle circle{ { points[0] }, 1 };
+
+			for (size_t i = 1; i < n; ++i)
+			{
+				const Vec2 p0 = points[i];
+
+				if (circle.contains(p0))
+				{
+					continue;
+				}
+
+				circle = SupportCircle{ { p0 }, 1 };
+
+				for (size_t j = 0; j < i; ++j)
+				{
+					const Vec2 p1 = points[j];
+
+					if (circle.contains(p1))
+					{
+						continue;
+					}
+
+					circle = SupportCircle{ { p0, p1 }, 2 };
+
+					for (size_t k = 0; k < j; ++k)
+					{
+						const Vec2 p2 = points[k];
+
+						if (not circle.contains(p2))
+						{
+							circle = MakeSupportCircle(p0, p1, p2);
+						}
+					}
+				}
+			}
+
+			return circle;
+		}
+		/// @brief シャッフル済みの円の集合 circles のすべての円を含む最小の円を、先頭から順に円を広げていくことで求めます。
+		/// @param circles 円の集合（1 個以上）
+		/// @param tolerance 円が円に含まれているかの判定時の許容誤差
+		/// @return 円の集合の最小包含円
+		/// @remark GrowEnclosingCircle と同じ手順で、2 円・3 円に内接する円を使います。3 円に内接する円が数値的に求まらない場合は、3 円の最小包含円で代用します。
+		[[nodiscard]]
+		Circle GrowEnclosingCircleOfCircles(std::span<const Circle> circles, double tolerance);
+
+		/// @brief Array<Vec2> を受け取る SmallestEnclosingCircle の本体です。
+		/// @tparam Containment 判定方法の型
+		/// @tparam Recorder 統計の記録方法（NoStatsRecorder または StatsRecorder）
+		template <class Containment, class URBG, class Recorder>
+		[[nodiscard]]
+		Circle SmallestEnclosingCircleArray(Array<Vec2> points, const Containment& containment, URBG&& urbg, const Prefilter prefilter, const Recorder& recorder)
+		{
+			if (prefilter && (4 < points.size()))
+			{
+				RemoveInteriorPoints(points);
+			}
+
+			if (points.size() <= 4)
+			{
+				return SmallestEnclosingCircleFew(ContiguousPointsView{ points.data() }, points.size(), containment);
+			}
+
+			recorder.timeShuffle([&]() { points.shuffle(std::forward<URBG>(urbg)); });
+
+			// 包含判定をまとめて行えるよう、シャッフル後の点群を x 座標・y 座標の配列に分けて持つ。
+			const size_t n = points.size();
+			Array<double> coordinates(n * 2);
+			double* const xs = coordinates.data();
+			double* const ys = (coordinates.data() + n);
+
+			for (size_t i = 0; i < n; ++i)
+			{
+				xs[i] = points[i].x;
+				ys[i] = points[i].y;
+			}
+
+			return GrowEnclosingCircle(SeparatedPointsView{ xs, ys }, n, containment, recorder);
+		}
+    }
+
+    namespace Geometry2D {
+        
+        SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(Array<Vec2> points, const double tolerance, URBG&& urbg, const Prefilter prefilter)
+		{
+			return detail::SmallestEnclosingCircleArray(std::move(points), CombinedTolerance{ tolerance }, std::forward<URBG>(urbg), prefilter, detail::NoStatsRecorder{});
+		}
+
+		template <ContainmentPolicy Containment>
+		Circle SmallestEnclosingCircle(Array<Vec2> points, const Containment& containment, const Prefilter prefilter)
+		{
+			return SmallestEnclosingCircle(std::move(points), containment, GetDefaultRNG(), prefilter);
+		}
+
+		template <ContainmentPolicy Containment, class URBG>
+			requires std::uniform_random_bit_generator<std::remove_reference_t<URBG>>
+		Circle SmallestEnclosingCircle(Array<Vec2> points, const Containment& containment, URBG&& urbg, const Prefilter prefilter)
+		{
+			return detail::SmallestEnclosingCircleArray(std::move(points), containment, std::forward<URBG>(urbg), prefilter, detail::NoStatsRecorder{});
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(Array<Vec2> points, SmallestEnclosingCircleStats& stats, const double tolerance, URBG&& urbg, const Prefilter prefilter)
+		{
+			return detail::SmallestEnclosingCircleArray(std::move(points), CombinedTolerance{ tolerance }, std::forward<URBG>(urbg), prefilter, detail::StatsRecorder{ stats });
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(Array<Vec2> points, URBG&& urbg, const double tolerance, const Prefilter prefilter)
+		{
+			return SmallestEnclosingCircle(std::move(points), tolerance, std::forward<URBG>(urbg), prefilter);
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(const std::span<Vec2> points, const double tolerance, URBG&& urbg)
+		{
+			if (points.size() <= 4)
+			{
+				return detail::SmallestEnclosingCircleFew(detail::ContiguousPointsView{ points.data() }, points.size(), tolerance);
+			}
+
+			// 呼び出し元のバッファをそのままシャッフルし、コピーせずに判定する。
+			Shuffle(points.begin(), points.end(), std::forward<URBG>(urbg));
+
+			return detail::GrowEnclosingCircle(detail::ContiguousPointsView{ points.data() }, points.size(), tolerance);
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(const std::span<Vec2> points, URBG&& urbg, const double tolerance)
+		{
+			return SmallestEnclosingCircle(points, tolerance, std::forward<URBG>(urbg));
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(const std::span<const Vec2> points, const double tolerance, URBG&& urbg)
+		{
+			if (points.size() <= 4)
+			{
+				return detail::SmallestEnclosingCircleFew(detail::ContiguousPointsView{ points.data() }, points.size(), tolerance);
+			}
+
+			if (std::numeric_limits<uint32>::max() < points.size())
+			{
+				return SmallestEnclosingCircle(Array<Vec2>(points.begin(), points.end()), tolerance, std::forward<URBG>(urbg));
+			}
+
+			// 点そのもの（16 バイト）ではなく、4 バイトの添字の並びをシャッフルする。
+			Array<uint32> indices(points.size());
+			std::iota(indices.begin(), indices.end(), 0u);
+			indices.shuffle(std::forward<URBG>(urbg));
+
+			return detail::GrowEnclosingCircle(detail::IndexedPointsView{ points.data(), indices.data() }, points.size(), tolerance);
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(const std::span<const Vec2> points, URBG&& urbg, const double tolerance)
+		{
+			return SmallestEnclosingCircle(points, tolerance, std::forward<URBG>(urbg));
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(const std::span<const Float2> points, const double tolerance, URBG&& urbg)
+		{
+			if (points.size() <= 4)
+			{
+				return detail::SmallestEnclosingCircleFew(detail::ContiguousPointsView{ points.data() }, points.size(), tolerance);
+			}
+
+			// 単精度のままコピーしてシャッフルする。包含判定で読み込むデータ量は Vec2 の半分になる。
+			Array<Float2> shuffled(points.begin(), points.end());
+			shuffled.shuffle(std::forward<URBG>(urbg));
+			detail::MoveAxisExtremesToFront(std::span<Float2>{ shuffled });
+
+			return detail::GrowEnclosingCircle(detail::ContiguousPointsView{ shuffled.data() }, shuffled.size(), tolerance);
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(const std::span<const Float2> points, URBG&& urbg, const double tolerance)
+		{
+			return SmallestEnclosingCircle(points, tolerance, std::forward<URBG>(urbg));
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircleParallel(const std::span<const Vec2> points, const double tolerance, URBG&& urbg, size_t threadCount)
+		{
+			if (threadCount == 0)
+			{
+				threadCount = Threading::GetConcurrency();
+			}
+
+			const size_t n = points.size();
+
+			// 標本の大きさ。含まれない点の個数の期待値は 3n / sampleSize 程度になる。
+			const size_t sampleSize = Max<size_t>(1024, static_cast<size_t>(std::sqrt(static_cast<double>(n)) * 4));
+
+			if ((threadCount <= 1) || (n <= (sampleSize * 4)))
+			{
+				return SmallestEnclosingCircle(points, tolerance, std::forward<URBG>(urbg));
+			}
+
+			Array<Vec2> working(sampleSize);
+			{
+				std::uniform_int_distribution<size_t> dist{ 0, (n - 1) };
+
+				for (auto& p : working)
+				{
+					p = points[dist(urbg)];
+				}
+			}
+
+			// 基底（円を定める高々 3 点）のうち少なくとも 1 点が毎回追加されるため、通常は数回で終わる。
+			// 丸め誤差により収束しない場合に備えて回数を制限し、超えたら 1 スレッドで求め直す。
+			constexpr size_t MaxRounds = 8;
+
+			// スレッドの起動は各回ではなく 1 度だけにする。
+			detail::UncontainedScanner scanner{ points, threadCount };
+
+			for (size_t round = 0; round < MaxRounds; ++round)
+			{
+				const Circle circle = SmallestEnclosingCircle(std::span<Vec2>{ working }, tolerance, urbg);
+
+				if (scanner.appendUncontained(circle, tolerance, working) == 0)
+				{
+					return circle;
+				}
+			}
+
+			return SmallestEnclosingCircle(points, tolerance, std::forward<URBG>(urbg));
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(Array<Circle> circles, const double tolerance, URBG&& urbg)
+		{
+			if (circles.isEmpty())
+			{
+				return Circle{};
+			}
+
+			circles.shuffle(std::forward<URBG>(urbg));
+
+			return detail::GrowEnclosingCircleOfCircles(circles, tolerance);
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(Array<Circle> circles, URBG&& urbg, const double tolerance)
+		{
+			return SmallestEnclosingCircle(std::move(circles), tolerance, std::forward<URBG>(urbg));
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(const std::span<const RectF> rects, const double tolerance, URBG&& urbg)
+		{
+			if (rects.size() <= 1)
+			{
+				return (rects.empty() ? Circle{} : SmallestEnclosingCircle(rects.front()));
+			}
+
+			const size_t n = (rects.size() * 4);
+
+			if (std::numeric_limits<uint32>::max() < n)
+			{
+				Array<Vec2> vertices;
+				vertices.reserve(n);
+
+				for (const RectF& rect : rects)
+				{
+					for (size_t i = 0; i < 4; ++i)
+					{
+						vertices << rect.point(i);
+					}
+				}
+
+				return SmallestEnclosingCircle(std::move(vertices), tolerance, std::forward<URBG>(urbg));
+			}
+
+			// 頂点そのもの（16 バイト）を並べる代わりに、4 バイトの頂点の番号の並びをシャッフルする。
+			Array<uint32> indices(n);
+			std::iota(indices.begin(), indices.end(), 0u);
+			indices.shuffle(std::forward<URBG>(urbg));
+
+			return detail::GrowEnclosingCircle(detail::RectVerticesView{ rects.data(), indices.data() }, n, tolerance);
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircle(const Polygon& polygon, const double tolerance, URBG&& urbg)
+		{
+			// 穴は外周の内側にあるので、外周の頂点だけを参照する。
+			return SmallestEnclosingCircle(std::span<const Vec2>{ polygon.outer() }, tolerance, std::forward<URBG>(urbg));
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Circle SmallestEnclosingCircleRobust(const std::span<const Vec2> points, URBG&& urbg)
+		{
+			if (points.empty())
+			{
+				return Circle{};
+			}
+
+			Array<Vec2> shuffled(points.begin(), points.end());
+			shuffled.shuffle(std::forward<URBG>(urbg));
+
+			if (4 <= shuffled.size())
+			{
+				detail::MoveAxisExtremesToFront(std::span<Vec2>{ shuffled });
+			}
+
+			return detail::GrowEnclosingCircleRobust(detail::ContiguousPointsView{ shuffled.data() }, shuffled.size()).asCircle();
+		}
+    }
+
+	namespace Geometry3D {
+
+		SIV3D_CONCEPT_URBG_
+		Sphere SmallestEnclosingSphere(Array<Vec3> points, const double tolerance, URBG&& urbg)
+		{
+			if (points.isEmpty())
+			{
+				return Sphere{ Vec3{ 0, 0, 0 }, 0.0 };
+			}
+
+			points.shuffle(std::forward<URBG>(urbg));
+
+			// 包含判定をまとめて行えるよう、シャッフル後の点群を x 座標・y 座標・z 座標の配列に分けて持つ。
+			const size_t n = points.size();
+			Array<double> coordinates(n * 3);
+			double* const xs = coordinates.data();
+			double* const ys = (coordinates.data() + n);
+			double* const zs = (coordinates.data() + (n * 2));
+
+			for (size_t i = 0; i < n; ++i)
+			{
+				xs[i] = points[i].x;
+				ys[i] = points[i].y;
+				zs[i] = points[i].z;
+			}
+
+			return detail::GrowEnclosingBall<3>(detail::SeparatedPoints3DView{ xs, ys, zs }, n, Geometry2D::CombinedTolerance{ tolerance }, detail::NoStatsRecorder{});
+		}
+
+		SIV3D_CONCEPT_URBG_
+		Sphere SmallestEnclosingSphere(Array<Vec3> points, URBG&& urbg, const double tolerance)
+		{
+			return SmallestEnclosingSphere(std::move(points), tolerance, std::forward<URBG>(urbg));
+		}
+	}
 }
\ No newline at end of file
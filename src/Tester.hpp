@@ -1,8 +1,15 @@
 # pragma once
 # include <Siv3D.hpp> // Siv3D v0.6.15 
+# include <bit>
+# include <chrono>
+# include <deque>
 # include <fstream>
+# include <map>
+# include <mutex>
+# include <thread>
 # include "SmallestEnclosingCircle.hpp"
 # include "Generator.hpp"
+# include "PointFile.hpp"
 
 
 
@@ -12,6 +19,65 @@
 
 
 
+/** @brief 期待値（正しいと考えられる最小包含円）を算出する方法 */
+enum class ReferenceOracle {
+    /** 凸包上の3点の組を全て試す、O(h⁴)の`SmallestEnclosingCircleNaive` */
+    Naive,
+    /** 凸包上で円から最も遠い点を取り込んでいく、決定的な`SmallestEnclosingCircleFarthestPoint` */
+    FarthestPoint,
+};
+
+/** `ReferenceOracle::FarthestPoint`を使う場合に、`SmallestEnclosingCircleNaive`とも突き合わせる点数の上限 */
+constexpr size_t NAIVE_CROSS_CHECK_LIMIT = 64;
+
+/** `TestRandomSpheres`で`SmallestEnclosingSphereNaive`と突き合わせる点数の上限（O(n⁵)なので2次元より小さくする） */
+constexpr size_t SPHERE_NAIVE_LIMIT = 32;
+
+/** `FeatureTests`のうち`all_sizes`が`false`の（時間のかかる）テストを行う点数の上限。これより多い問題例では、それらのテストを省く。 */
+constexpr size_t FEATURE_TEST_LIMIT = 100'000;
+
+/** `TestApproximate`で`SmallestEnclosingCircleApproximate`に渡す近似の精度 */
+constexpr double APPROXIMATION_EPSILON = 1e-3;
+
+/**
+ * @brief 1つの問題例にかける時間の上限。既定値は上限なし。
+ * 期待値の計算や各テストはループの途中で`expired`を確かめ、上限を過ぎていればその時点の値を返して打ち切る。
+ * 打ち切った場合の戻り値は意味を持たないので、呼び出し側は戻った後に`expired`を確かめ、時間切れとして扱う。
+ */
+struct TestDeadline {
+    /** 上限の時刻。`none`の場合は上限なし。 */
+    Optional<std::chrono::steady_clock::time_point> time;
+
+    /** @brief 今から`seconds`秒後を上限とする。`seconds`が0以下の場合は上限なし。 */
+    static TestDeadline After(const double seconds) {
+        if (seconds <= 0) { return TestDeadline{}; }
+        return TestDeadline{ std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds)) };
+    }
+
+    /** @brief 上限の時刻を過ぎたか */
+    bool expired() const {
+        return time and (*time < std::chrono::steady_clock::now());
+    }
+};
+
+/** @brief 問題例ごとに`TestSmallestEnclosing`とは別に行う、`SmallestEnclosingCircle`以外の機能のテスト。一覧は`FeatureTests`を参照。 */
+struct FeatureTest {
+    /** 機能の名前（`fulltest.log`に出力する） */
+    String name;
+    /** 点群・期待値・許容誤差・時間の上限から、合致したかを返す関数。上限を過ぎたら途中で打ち切ってよい（`TestDeadline`を参照）。 */
+    std::function<bool(const Array<Vec2>&, const Circle&, double, const TestDeadline&)> test;
+    /** 点数が`FEATURE_TEST_LIMIT`を超える問題例でも行うか。O(n)程度で終わるテストは全ての問題例で行う。 */
+    bool all_sizes;
+};
+
+/** @brief 期待値を算出した結果。`FullTestConfig::cache_path`にキャッシュされる。 */
+struct OracleResult {
+    /** `ReferenceOracle`で選ばれた方法で算出された、正しいと考えられる最小包含円 */
+    Circle expected;
+    /** 点数が少ない場合に、期待値が`SmallestEnclosingCircleNaive`の出力とも合致したか（突き合わせなかった場合は`true`） */
+    bool oracles_agreed;
+};
+
 /** @brief テストの結果を表す構造体 */
 struct TestCaseResult {
     /** 与えられた要件（最小性と内包性）を満たした解を出力できているか */
@@ -20,10 +86,42 @@ struct TestCaseResult {
     double process_time;
     /** テスト対象の方法で算出された最小包含円 */
     Circle actual;
-    /** ナイーブな方法で算出された、正しいと考えられる最小包含円。 */
+    /** `ReferenceOracle`で選ばれた方法で算出された、正しいと考えられる最小包含円。 */
     Circle expected;
+    /** 点数が少ない場合に、期待値が`SmallestEnclosingCircleNaive`の出力とも合致したか（突き合わせなかった場合は`true`） */
+    bool oracles_agreed;
+    /** テスト対象の関数に渡した乱数生成器の種。同じ種を渡せば、同じシャッフルの結果で実行し直せる。 */
+    uint64 seed;
+    /** 時間を計った実行と同じ種で、`SmallestEnclosingCircleStats`を取りながら実行し直した記録 */
+    SmallestEnclosingCircleStats stats;
+    /** 入力ファイルが読み取れなかったか（チェックサムの不一致・途中で切れたファイル・書式の誤り）。`true`の場合、`succeeded`は`false`で、他のフィールドは全て値初期化されている。 */
+    bool input_error;
+    /**
+     * `FullTestConfig::case_timeout_seconds`以内に終わらなかったか。`true`の場合、`succeeded`は`false`で、
+     * 期待値（`expected`, `oracles_agreed`）は求め終えていればその値、他のフィールドは値初期化されている。
+     */
+    bool timed_out;
 };
 
+/** @brief `FullTest`の設定 */
+struct FullTestConfig {
+    /** 問題例を並列に解くスレッド数。0の場合は`Threading::GetConcurrency()`の値を使う。`fulltest.log`の内容の順序はスレッド数によらない。 */
+    size_t thread_count = 0;
+    /**
+     * 1つの問題例にかける時間の上限[s]。0以下の場合は上限を設けない。
+     * 上限は問題例を解いているスレッド自身が期待値の計算や各チェックのループの途中で確かめ、超えていればそこで打ち切って`[TLE]`とする（詳しくは`RunTestCase`）。
+     * 追加のスレッドは立てないので、同時に走る問題例は`thread_count`個を超えず、`TestAllCases`から戻った後に走り続ける計算もない。
+     */
+    double case_timeout_seconds = 600.0;
+    /** 期待値のキャッシュを読み書きするか */
+    bool use_cache = true;
+    /** 期待値のキャッシュファイル。点群と許容誤差のハッシュ値ごとに期待値を記録し、入力が変わらない問題例では期待値の計算を省く。 */
+    FilePath cache_path = U"fulltest-cache.txt";
+};
+
+/** @brief 期待値のキャッシュ。キーは`OracleCacheKey`で求める。 */
+using OracleCache = std::map<uint64, OracleResult>;
+
 /** @brief 点群`points`に対して行われたテストの結果`result`を出力する。
  * @param testcase_name テストケースの名前
  * @param EPSILON 点が円に含まれているか判定する時の許容誤差（絶対誤差・相対誤差ともに同じ値が使われる。）
@@ -40,10 +138,22 @@ void DrawTestResult(
 /** 真値`expecetd`に対する値`actual`の相対誤差・絶対誤差が`err`以下である時に限り`true`を返す。 */
 bool EqualRelativeErr(const double expected, const double actual, const double err);
 
-/** @brief `filepath`に指定されたファイル（テスト入力）から、点群を読み取る。 */
-Array<Vec2> GetInputFromFile(const FilePath& filepath);
+/** 真値`expected`に対する円`actual`の中心の各座標と半径が、いずれも`EqualRelativeErr`の意味で許容誤差`err`以内である時に限り`true`を返す。 */
+bool CircleMatches(const Circle& expected, const Circle& actual, const double err);
 
-/** @brief テスト入力の記述されたファイルの名前一覧を全て取得する。 */
+/** 真値`expected`に対する球`actual`の中心の各座標と半径が、いずれも`EqualRelativeErr`の意味で許容誤差`err`以内である時に限り`true`を返す。 */
+bool CircleMatches(const Sphere& expected, const Sphere& actual, const double err);
+
+/**
+ * @brief `filepath`に指定されたファイル（テスト入力）から、点群を読み取る。拡張子が`.bin`であればバイナリ形式、それ以外はテキスト形式として読む。
+ * ファイルが読み取れない場合（バイナリ形式のヘッダやチェックサムが不正な場合・テキスト形式の書式が誤っている場合）は空の`Optional`を返す。
+ */
+Optional<Array<Vec2>> GetInputFromFile(const FilePath& filepath);
+
+/**
+ * @brief テスト入力の記述されたファイル（`.txt`または`.bin`）の名前一覧を全て取得する。
+ * 同じ名前で両方の形式がある場合は、`.bin`が`.txt`より新しければ`.bin`だけを、そうでなければ（`.txt`を生成し直した後であれば）`.txt`だけを返す。
+ */
 Array<FilePath> ReadAllTestCases();
 
 /**
@@ -64,8 +174,10 @@ Mat3x2 RenderedAreaMat(const Array<Vec2>& current_instance, const RectF& view_ar
 
 
 
-/** @brief 点群`points`に対する最小包含円問題の正答（期待値）を出力する。 by ラクラムシさん */
-Circle SmallestEnclosingCircleNaive(const Array<Vec2>& points, const double epsilon)
+/** @brief 点群`points`に対する最小包含円問題の正答（期待値）を出力する。 by ラクラムシさん
+ * `deadline`を過ぎた場合は途中で打ち切る（戻り値は意味を持たない）。
+ */
+Circle SmallestEnclosingCircleNaive(const Array<Vec2>& points, const double epsilon, const TestDeadline& deadline = {})
 {
     const auto convexHull = Geometry2D::ConvexHull(points).outer();
     // #FIXED: convexHullが空だった場合は、点群を元のpointsに戻しておく。
@@ -80,76 +192,739 @@ Circle SmallestEnclosingCircleNaive(const Array<Vec2>& points, const double epsi
     Circle smallest{ 0, 0, Math::Inf };
     for (size_t i = 2; i < n; ++i)
     for (size_t j = 1; j < i; ++j)
-    for (size_t k = 0; k < j; ++k)
     {
-        const auto c = SmallestEnclosingCircle(eliminated_points[i], eliminated_points[j], eliminated_points[k]);
-        if ((c.r < smallest.r) && eliminated_points.all([&](const Vec2& p) { return detail::Contains(c, p, epsilon); }))
+        // 内側のループはO(jh)なので、ここで時間の上限を確かめる。
+        if (deadline.expired()) { return smallest; }
+        for (size_t k = 0; k < j; ++k)
+        {
+            const auto c = SmallestEnclosingCircle(eliminated_points[i], eliminated_points[j], eliminated_points[k]);
+            if ((c.r < smallest.r) && eliminated_points.all([&](const Vec2& p) { return detail::Contains(c, p, epsilon); }))
+            {
+                smallest = c;
+            }
+        }
+    }
+    return smallest;
+}
+
+
+/** @brief 点群`points`に対する最小包含円問題の正答（期待値）を、円から最も遠い点を取り込んでいく方法（Elzinga–Hearn）で出力する。
+ * 凸包の頂点のうち現在の円の中心から最も遠い点が円の外にあれば、その点を境界上に持ち、円を定めている高々3点も含む最小の円に取り替えることを繰り返す。
+ * 半径は単調に増加し、円を定める点の組は有限個なので必ず停止する。
+ * 乱数を使わず、凸包を求めた後は1回あたりO(h)の走査を数回繰り返すだけなので、`SmallestEnclosingCircleNaive`と違ってhが大きい入力でも高速に動く。
+ * `deadline`を過ぎた場合は走査の合間で打ち切る（戻り値は意味を持たない）。
+ */
+Circle SmallestEnclosingCircleFarthestPoint(const Array<Vec2>& points, const double epsilon, const TestDeadline& deadline = {})
+{
+    const auto convexHull = Geometry2D::ConvexHull(points).outer();
+    const auto eliminated_points = (convexHull.empty()) ? points : convexHull;
+
+    if (eliminated_points.size() == 0) { return Circle{}; }
+    if (eliminated_points.size() == 1) { return Circle{eliminated_points[0], 0}; }
+
+    const auto farthest_from = [&](const Vec2& center) {
+        return *std::max_element(eliminated_points.begin(), eliminated_points.end(),
+            [&](const Vec2& a, const Vec2& b) { return center.distanceFromSq(a) < center.distanceFromSq(b); });
+    };
+
+    // 適当な1点と、そこから最も遠い点を直径とする円から始める。
+    Array<Vec2> support = { eliminated_points[0], farthest_from(eliminated_points[0]) };
+    Circle circle{ support[0], support[1] };
+
+    while (not deadline.expired())
+    {
+        const Vec2 p = farthest_from(circle.center);
+        if (detail::Contains(circle, p, epsilon)) { break; }
+
+        // pを境界上に持ち、supportの点を全て含む円のうち最小のもの。候補はpとsupportの1点、またはpとsupportの2点で定まる円に限られる。
+        Array<Vec2> next_support;
+        Circle next{ 0, 0, Math::Inf };
+        const auto try_candidate = [&](const Circle& candidate, const Array<Vec2>& candidate_support) {
+            if ((candidate.r < next.r) && support.all([&](const Vec2& q) { return detail::Contains(candidate, q, epsilon); }))
+            {
+                next = candidate;
+                next_support = candidate_support;
+            }
+        };
+        for (size_t i = 0; i < support.size(); ++i)
+        {
+            try_candidate(Circle{ p, support[i] }, { p, support[i] });
+            for (size_t j = 0; j < i; ++j)
+            {
+                const Triangle triangle{ p, support[i], support[j] };
+                // 3点が同一直線上にある場合は外接円が定まらない。
+                if (triangle.area() == 0) { continue; }
+                try_candidate(triangle.getCircumscribedCircle(), { p, support[i], support[j] });
+            }
+        }
+
+        // 丸め誤差で半径が増えなくなった場合は打ち切る。
+        if (next.r <= circle.r) { break; }
+        circle = next;
+        support = next_support;
+    }
+    return circle;
+}
+
+
+/**
+ * @brief 円の集合`circles`に対する最小包含円を、1つ・2つ・3つの円を含む最小の円を全て試して出力する。O(n⁴)なので、少ない個数の場合に限って使う。
+ * `deadline`を過ぎた場合は途中で打ち切る（戻り値は意味を持たない）。
+ */
+Circle SmallestEnclosingCircleOfCirclesNaive(const Array<Circle>& circles, const double epsilon, const TestDeadline& deadline = {})
+{
+    const size_t n = circles.size();
+    if (n == 0) { return Circle{}; }
+
+    Circle smallest{ 0, 0, Math::Inf };
+    const auto try_candidate = [&](const Circle& c) {
+        if ((c.r < smallest.r) && circles.all([&](const Circle& inner) { return detail::Contains(c, inner, epsilon); }))
         {
             smallest = c;
         }
+    };
+    for (size_t i = 0; i < n; ++i)
+    {
+        try_candidate(circles[i]);
+        for (size_t j = 0; j < i; ++j)
+        {
+            if (deadline.expired()) { return smallest; }
+            try_candidate(SmallestEnclosingCircle(circles[i], circles[j]));
+            for (size_t k = 0; k < j; ++k)
+            {
+                try_candidate(SmallestEnclosingCircle(circles[i], circles[j], circles[k], epsilon));
+            }
+        }
     }
     return smallest;
 }
 
+/** @brief 3次元の点群`points`に対する最小包含球を、2点・3点・4点で定まる球を全て試して出力する。O(n⁵)なので、少ない点数の場合に限って使う。 */
+Sphere SmallestEnclosingSphereNaive(const Array<Vec3>& points, const double epsilon)
+{
+    const size_t n = points.size();
+    if (n == 0) { return Sphere{ Vec3{ 0, 0, 0 }, 0.0 }; }
+    if (n == 1) { return Sphere{ points[0], 0.0 }; }
+
+    // 最小包含球は、境界上の2点・3点・4点を通る球のうち最小のもののいずれかになる。
+    Sphere smallest{ Vec3{ 0, 0, 0 }, Math::Inf };
+    const auto try_candidate = [&](const Sphere& s) {
+        if ((s.r < smallest.r) && points.all([&](const Vec3& p) { return detail::Contains(s, p, epsilon); }))
+        {
+            smallest = s;
+        }
+    };
+    for (size_t i = 0; i < n; ++i)
+    for (size_t j = 0; j < i; ++j)
+    {
+        try_candidate(Sphere{ (points[i] + points[j]) * 0.5, points[i].distanceFrom(points[j]) * 0.5 });
+        for (size_t k = 0; k < j; ++k)
+        {
+            try_candidate(detail::CircumscribedSphere(points[i], points[j], points[k]));
+            for (size_t l = 0; l < k; ++l)
+            {
+                try_candidate(detail::CircumscribedSphere(points[i], points[j], points[k], points[l]));
+            }
+        }
+    }
+    return smallest;
+}
+
+/**
+ * @brief 点群`points`に対する期待値を`oracle`で選んだ方法で求め、点数が少ない場合は`SmallestEnclosingCircleNaive`の出力とも突き合わせる。
+ * `deadline`を過ぎた場合は途中で打ち切る。その場合の戻り値は意味を持たないので、キャッシュしてはならない。
+ */
+OracleResult ComputeOracle(
+    const Array<Vec2>& points,
+    const double epsilon,
+    const ReferenceOracle oracle = ReferenceOracle::FarthestPoint,
+    const TestDeadline& deadline = {}
+) {
+    const Circle expected = (oracle == ReferenceOracle::Naive)
+        ? SmallestEnclosingCircleNaive(points, epsilon, deadline)
+        : SmallestEnclosingCircleFarthestPoint(points, epsilon, deadline);
+
+    // 2つの独立な方法が合致することを、ナイーブな方法が現実的な時間で終わる点数の場合に限って確かめる。
+    bool oracles_agreed = true;
+    if ((oracle != ReferenceOracle::Naive) && (points.size() <= NAIVE_CROSS_CHECK_LIMIT)) {
+        const Circle naive = SmallestEnclosingCircleNaive(points, epsilon, deadline);
+        oracles_agreed = CircleMatches(naive, expected, epsilon);
+    }
+    return OracleResult{ expected, oracles_agreed };
+}
+
+/** @brief SmallestEnclosingCircleを最小性と包含性をチェックする。他の機能のテストは`FeatureTests`を参照。
+ * @param oracle_result `ComputeOracle`で求めた（またはキャッシュから取り出した）期待値
+ * @param deadline 時間を計った実行の後でこれを過ぎていた場合は、記録を取るための2回目の実行を省く（`stats`は値初期化のまま）。
+ */
+TestCaseResult TestSmallestEnclosing(
+    const Array<Vec2>& points,
+    const OracleResult& oracle_result,
+    const double epsilon,
+    const TestDeadline& deadline = {}
+) {
+    const Circle expected = oracle_result.expected;
+    const bool oracles_agreed = oracle_result.oracles_agreed;
 
-/** @brief SmallestEnclosingCircleを最小性と包含性をチェックする。 */
-TestCaseResult TestSmallestEnclosing(const Array<Vec2>& points, const double epsilon) {
-    const Circle expected = SmallestEnclosingCircleNaive(points, epsilon);
     Circle actual;
 
+    // 時間を計る実行には記録の処理を含めず、同じ種でもう一度実行して記録を取る。
+    // 同じ種であれば同じ順序にシャッフルされるので、記録は時間を計った実行のものと一致する。
+    const uint64 seed = RandomUint64();
+    DefaultRNG rng;
+    rng.seed(seed);
     const auto start = std::chrono::high_resolution_clock::now();
     {
-        actual = SmallestEnclosingCircle(points, epsilon);    
+        actual = SmallestEnclosingCircle(points, epsilon, rng);    
     }
     const auto end = std::chrono::high_resolution_clock::now();
     const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
     const double time = double(duration.count()) / 1e9;
 
-    const bool succeeded =
-        EqualRelativeErr(expected.center.x, actual.center.x, epsilon)
-        and EqualRelativeErr(expected.center.y, actual.center.y, epsilon)
-        and EqualRelativeErr(expected.r, actual.r, epsilon);
-    
+    SmallestEnclosingCircleStats stats{};
+    if (not deadline.expired()) {
+        rng.seed(seed);
+        (void)SmallestEnclosingCircle(points, stats, epsilon, rng);
+    }
+
+    const bool succeeded = oracles_agreed and CircleMatches(expected, actual, epsilon);
+
     return TestCaseResult{
         succeeded,
         time,
         actual,
-        expected
+        expected,
+        oracles_agreed,
+        seed,
+        stats,
+        false,
+        false
     };
 };
 
+/** @brief 期待値を`oracle`で選んだ方法で求めてから、`TestSmallestEnclosing`でチェックする。 */
+TestCaseResult TestSmallestEnclosing(
+    const Array<Vec2>& points,
+    const double epsilon,
+    const ReferenceOracle oracle = ReferenceOracle::FarthestPoint
+) {
+    return TestSmallestEnclosing(points, ComputeOracle(points, epsilon, oracle), epsilon);
+}
+
+/** @brief `SmallestEnclosingCircleApproximate`の出力が全ての点を含み、その半径が期待値`expected`の(1 + `APPROXIMATION_EPSILON`)倍以内であるかをチェックする。 */
+bool TestApproximate(const Array<Vec2>& points, const Circle& expected, const double epsilon, const TestDeadline&) {
+    const ApproximateEnclosingCircle approximate = SmallestEnclosingCircleApproximate(points, APPROXIMATION_EPSILON);
+    return (approximate.circle.r <= (1 + APPROXIMATION_EPSILON) * expected.r + epsilon)
+        and points.all([&](const Vec2& p) { return detail::Contains(approximate.circle, p, epsilon); });
+}
+
+/** @brief 許容誤差を使わない`SmallestEnclosingCircleRobust`の出力が期待値`expected`と合致するかをチェックする。 */
+bool TestRobust(const Array<Vec2>& points, const Circle& expected, const double epsilon, const TestDeadline&) {
+    return CircleMatches(expected, SmallestEnclosingCircleRobust(points), epsilon);
+}
+
+/**
+ * @brief 点を半径0の円とみなした円の集合に対する`SmallestEnclosingCircle`の出力が期待値`expected`と合致するかをチェックする。
+ * 点数が少ない場合は、点ごとに異なる半径を与えた円の集合についても、全ての組を試す`SmallestEnclosingCircleOfCirclesNaive`と突き合わせる。
+ */
+bool TestCircles(const Array<Vec2>& points, const Circle& expected, const double epsilon, const TestDeadline& deadline) {
+    // 点を半径0の円とみなした円の集合の最小包含円は、点群の最小包含円と一致する。
+    const Circle circles = SmallestEnclosingCircle(points.map([](const Vec2& p) { return Circle{ p, 0.0 }; }), epsilon);
+    const bool points_succeeded = CircleMatches(expected, circles, epsilon);
+    if ((points.size() > NAIVE_CROSS_CHECK_LIMIT) or deadline.expired()) {
+        return points_succeeded;
+    }
+    Array<Circle> disks(points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        disks[i] = Circle{ points[i], expected.r * 0.05 * (i % 4) };
+    }
+    return points_succeeded
+        and CircleMatches(SmallestEnclosingCircleOfCirclesNaive(disks, epsilon, deadline), SmallestEnclosingCircle(disks, epsilon), epsilon);
+}
 
-/** @brief all_casesに渡された問題例が合致しているかを判定し、ログファイル`fulltest.log`・`test_results`にその結果を格納する。 */
+/** @brief `SmallestEnclosingCircleRangeIndex`で求めた全体の最小包含円が期待値`expected`と、一部の区間の最小包含円が区間を直接解いた値と合致するかをチェックする。 */
+bool TestRangeIndex(const Array<Vec2>& points, const Circle& expected, const double epsilon, const TestDeadline& deadline) {
+    // 小さな点群でもセグメント木の内部の節点を使うよう、ブロックを小さくして索引を作る。
+    const SmallestEnclosingCircleRangeIndex range_index{ points, epsilon, 16 };
+    bool succeeded = CircleMatches(expected, range_index.query(0, points.size()), epsilon);
+    // 両端がブロックの境界からずれた区間を、区間の点だけを取り出して解いた値と突き合わせる。
+    const size_t n = points.size();
+    for (const auto& [first, last] : { std::pair{ n / 4, (n * 3) / 4 }, std::pair{ size_t{ 1 }, n }, std::pair{ n / 3, n / 3 + 17 } }) {
+        if (deadline.expired()) { break; }
+        if ((last <= first) or (n < last)) { continue; }
+        const Circle queried = range_index.query(first, last);
+        const Circle direct = SmallestEnclosingCircleFarthestPoint(Array<Vec2>(points.begin() + first, points.begin() + last), epsilon, deadline);
+        succeeded = succeeded and CircleMatches(direct, queried, epsilon);
+    }
+    return succeeded;
+}
+
+/** @brief 凸包に対する`SmallestEnclosingCircleConvex`の出力が期待値`expected`と合致するかをチェックする（凸包が定まらない場合は`true`）。 */
+bool TestConvex(const Array<Vec2>& points, const Circle& expected, const double epsilon, const TestDeadline&) {
+    // 全ての点が同一直線上にある場合は凸包が空になるので、突き合わせない。
+    const Polygon convex_hull = Geometry2D::ConvexHull(points);
+    if (convex_hull.isEmpty()) {
+        return true;
+    }
+    return CircleMatches(expected, SmallestEnclosingCircleConvex(convex_hull), epsilon);
+}
+
+/** @brief 点群を平面z = 0上に置いた3次元の点群に対する`SmallestEnclosingSphere`の出力が、期待値`expected`を大円とする球と合致するかをチェックする。 */
+bool TestPlanarSphere(const Array<Vec2>& points, const Circle& expected, const double epsilon, const TestDeadline&) {
+    // 同一平面上の点群の最小包含球は、その平面上での最小包含円を大円とする球になる。
+    const Sphere sphere = SmallestEnclosingSphere(points.map([](const Vec2& p) { return Vec3{ p.x, p.y, 0.0 }; }), epsilon);
+    return CircleMatches(Sphere{ Vec3{ expected.center.x, expected.center.y, 0.0 }, expected.r }, sphere, epsilon);
+}
+
+/**
+ * @brief `SmallestEnclosingCircleSolver`のヒントなし・前回の支持点をヒントにした・前回の円をヒントにした出力と、
+ * 平行移動した点群を前回の支持点から解いた出力が、期待値`expected`と合致するかをチェックする。
+ */
+bool TestSolver(const Array<Vec2>& points, const Circle& expected, const double epsilon, const TestDeadline& deadline) {
+    // 同じ点群を解き直す場合と、フレーム間で点群全体が少し動いた場合は、前回の支持点だけで最小包含円が確定するはず。
+    const auto matches = [&](const Circle& c, const Vec2& offset) {
+        return CircleMatches(Circle{ expected.center + offset, expected.r }, c, epsilon);
+    };
+    // 支持点は、最後に求めた円の境界上にあるはず。
+    const auto support_on_boundary = [&](const SmallestEnclosingCircleSolver& solver, const Array<Vec2>& solved) {
+        return std::ranges::all_of(solver.supportIndices(), [&](const uint32 index) {
+            return EqualRelativeErr(solver.circle().r, solver.circle().center.distanceFrom(solved[index]), epsilon);
+        });
+    };
+    SmallestEnclosingCircleSolver solver{ epsilon };
+    bool succeeded = matches(solver.solve(points), Vec2{ 0, 0 }) and support_on_boundary(solver, points);
+    if (deadline.expired()) { return succeeded; }
+    succeeded = succeeded and matches(solver.solve(points, solver.supportIndices()), Vec2{ 0, 0 }) and (points.isEmpty() or solver.warmStarted())
+        and support_on_boundary(solver, points);
+    if (deadline.expired()) { return succeeded; }
+    // 円の内側の点を混ぜたヒントを渡しても、支持点には実際に円を定めている点だけが残るはず。
+    Array<uint32> padded_hint(solver.supportIndices().begin(), solver.supportIndices().end());
+    for (uint32 index = 0; (padded_hint.size() < 3) and (index < points.size()); index++) {
+        if (not padded_hint.contains(index)) { padded_hint << index; }
+    }
+    succeeded = succeeded and matches(solver.solve(points, padded_hint), Vec2{ 0, 0 }) and support_on_boundary(solver, points);
+    if (deadline.expired()) { return succeeded; }
+    succeeded = succeeded and matches(solver.solve(points, expected), Vec2{ 0, 0 });
+    if (deadline.expired()) { return succeeded; }
+    const Vec2 offset{ expected.r * 0.01, expected.r * -0.02 };
+    return succeeded and matches(solver.solve(points.map([&](const Vec2& p) { return p + offset; }), solver.supportIndices()), offset);
+}
+
+/**
+ * @brief 問題例ごとに`TestSmallestEnclosing`とは別に行う、`SmallestEnclosingCircle`以外の機能のテストの一覧を返す。
+ * `all_sizes`が`false`のテストは、点数が`FEATURE_TEST_LIMIT`以下の問題例でだけ行う。
+ */
+Array<FeatureTest> FeatureTests() {
+    return {
+        { U"approx", TestApproximate, true },
+        { U"robust", TestRobust, false },
+        { U"circles", TestCircles, false },
+        { U"range", TestRangeIndex, false },
+        { U"convex", TestConvex, false },
+        { U"sphere", TestPlanarSphere, false },
+        { U"solver", TestSolver, false },
+    };
+}
+
+
+/** @brief 期待値のキャッシュのキーとして、点群`points`と許容誤差`epsilon`のFNV-1aハッシュ値を求める。 */
+uint64 OracleCacheKey(const Array<Vec2>& points, const double epsilon) {
+    uint64 hash = PointFileChecksum(points);
+    hash = (hash ^ std::bit_cast<uint64>(epsilon)) * 1099511628211ull;
+    hash = (hash ^ points.size()) * 1099511628211ull;
+    return hash;
+}
+
+/** `fulltest-cache.txt`の1行目。期待値の求め方や書式を変えた場合は値を変え、古いキャッシュを読まないようにする。 */
+constexpr StringView ORACLE_CACHE_HEADER = U"oracle-cache v1";
+
+/**
+ * @brief 期待値のキャッシュを`filepath`から読み込む。ファイルが無い・1行目が`ORACLE_CACHE_HEADER`でない場合は空のキャッシュを返す。
+ * 各行は`キー 中心のx 中心のy 半径 oracles_agreed`で、浮動小数点数は誤差なく読み戻せるようビット列を10進数の整数として書く。
+ */
+OracleCache LoadOracleCache(const FilePath& filepath) {
+    OracleCache cache;
+    TextReader reader{filepath};
+    if (not reader) { return cache; }
+    String line;
+    if ((not reader.readLine(line)) or (line != ORACLE_CACHE_HEADER)) { return cache; }
+    while (reader.readLine(line)) {
+        const Array<String> fields = line.split(U' ');
+        if (fields.size() != 5) { continue; }
+        const auto key = ParseOpt<uint64>(fields[0]);
+        const auto x = ParseOpt<uint64>(fields[1]);
+        const auto y = ParseOpt<uint64>(fields[2]);
+        const auto r = ParseOpt<uint64>(fields[3]);
+        if (not (key and x and y and r)) { continue; }
+        cache[*key] = OracleResult{
+            Circle{ std::bit_cast<double>(*x), std::bit_cast<double>(*y), std::bit_cast<double>(*r) },
+            (fields[4] == U"1")
+        };
+    }
+    return cache;
+}
+
+/** @brief 期待値のキャッシュ`cache`を`filepath`に書き出す。書式は`LoadOracleCache`を参照。 */
+bool SaveOracleCache(const FilePath& filepath, const OracleCache& cache) {
+    TextWriter writer{filepath};
+    if (not writer) { return false; }
+    writer << ORACLE_CACHE_HEADER;
+    for (const auto& [key, oracle_result] : cache) {
+        writer << U"{} {} {} {} {}"_fmt(
+            key,
+            std::bit_cast<uint64>(oracle_result.expected.center.x),
+            std::bit_cast<uint64>(oracle_result.expected.center.y),
+            std::bit_cast<uint64>(oracle_result.expected.r),
+            oracle_result.oracles_agreed ? 1 : 0);
+    }
+    return true;
+}
+
+/** @brief `TestAllCases`が1つの問題例について求めた結果 */
+struct TestCaseOutcome {
+    TestCaseResult result;
+    /** バイナリ形式の入力を`SmallestEnclosingCircleOutOfCore`でも解いた結果が期待値と合致したか（テキスト形式の入力は`true`） */
+    bool out_of_core_succeeded;
+    /** `FeatureTests`の各テストが合致したか（`FeatureTests`と同じ順）。点数が`FEATURE_TEST_LIMIT`を超えて省いたテストは`none`。 */
+    Array<Optional<bool>> feature_succeeded;
+    /** 期待値のキャッシュのキー */
+    uint64 oracle_key;
+    /** 期待値をキャッシュから取り出さずに、最後まで求めたか（期待値の計算の途中で時間切れになった場合は`false`） */
+    bool oracle_computed;
+};
+
+/**
+ * @brief `filepath`の問題例を読み込んで`TestSmallestEnclosing`でチェックする。
+ * 期待値が`cache`にあればそれを使い、無ければ`ComputeOracle`で求める。
+ *
+ * 時間の上限`timeout_seconds`（0以下の場合は上限なし）は`TestDeadline`として期待値の計算・`TestSmallestEnclosing`・`FeatureTests`の各テストに渡し、
+ * それぞれがループの途中で確かめて打ち切る。上限を過ぎていたら残りのチェックを行わずに時間切れとして返す。
+ * テスト対象の`SmallestEnclosingCircle`・`SmallestEnclosingCircleOutOfCore`などの1回の呼び出しの途中では止めないが、これらは期待O(n)で終わる。
+ */
+TestCaseOutcome RunTestCase(const FilePath& filepath, const double epsilon, const OracleCache& cache, const double timeout_seconds) {
+    const TestDeadline deadline = TestDeadline::After(timeout_seconds);
+
+    const Optional<Array<Vec2>> loaded = GetInputFromFile(filepath);
+    if (not loaded) {
+        TestCaseResult result{};
+        result.input_error = true;
+        return TestCaseOutcome{ result, false, {}, 0, false };
+    }
+    const Array<Vec2>& input = *loaded;
+    const uint64 oracle_key = OracleCacheKey(input, epsilon);
+    const auto cached = cache.find(oracle_key);
+    const bool oracle_computed = (cached == cache.end());
+    const OracleResult oracle_result = oracle_computed ? ComputeOracle(input, epsilon, ReferenceOracle::FarthestPoint, deadline) : cached->second;
+    if (oracle_computed and deadline.expired()) {
+        // 期待値の計算を打ち切った可能性があるので、期待値は残さない（キャッシュもしない）。
+        TestCaseResult result{};
+        result.timed_out = true;
+        return TestCaseOutcome{ result, false, {}, oracle_key, false };
+    }
+
+    // 期待値を求め終えた後の時間切れでは、次回のためにキャッシュできるよう期待値を残す。
+    const auto timed_out = [&]() {
+        TestCaseResult result{};
+        result.expected = oracle_result.expected;
+        result.oracles_agreed = oracle_result.oracles_agreed;
+        result.timed_out = true;
+        return TestCaseOutcome{ result, false, {}, oracle_key, oracle_computed };
+    };
+    const TestCaseResult result = TestSmallestEnclosing(input, oracle_result, epsilon, deadline);
+    if (deadline.expired()) { return timed_out(); }
+
+    Array<Optional<bool>> feature_succeeded;
+    for (const auto& feature : FeatureTests()) {
+        if ((not feature.all_sizes) and (FEATURE_TEST_LIMIT < input.size())) {
+            feature_succeeded << none;
+            continue;
+        }
+        feature_succeeded << feature.test(input, result.expected, epsilon, deadline);
+        if (deadline.expired()) { return timed_out(); }
+    }
+
+    // バイナリ形式の入力は、ファイルを小さな塊で読み直す`SmallestEnclosingCircleOutOfCore`でも解き、期待値と突き合わせる（テキスト形式の入力は合致したものとして数える）。
+    bool out_of_core_succeeded = true;
+    if (IsPointFile(filepath)) {
+        const auto out_of_core = SmallestEnclosingCircleOutOfCore(filepath, OutOfCoreConfig{ .chunk_points = 4096, .working_capacity = 4096, .epsilon = epsilon });
+        out_of_core_succeeded = out_of_core and out_of_core->converged
+            and CircleMatches(result.expected, out_of_core->circle, epsilon);
+        if (deadline.expired()) { return timed_out(); }
+    }
+    return TestCaseOutcome{ result, out_of_core_succeeded, std::move(feature_succeeded), oracle_key, oracle_computed };
+}
+
+/**
+ * @brief all_casesに渡された問題例が合致しているかを判定し、ログファイル`fulltest.log`・`test_results`にその結果を格納する。
+ *
+ * 問題例はファイルサイズの大きい順に各スレッドのキューへ配り、自分のキューが空になったスレッドは他のスレッドのキューの末尾（小さい問題例）を盗む。
+ * 結果は`all_cases`の順に集めてから出力するので、`fulltest.log`の内容の順序は実行順やスレッド数によらない。
+ */
 void TestAllCases(
     const Array<FilePath>& all_cases,
     Array<TestCaseResult>& test_results,
-    const double epsilon
+    const double epsilon,
+    const FullTestConfig& config = {}
 ) {
+    const OracleCache cache = config.use_cache ? LoadOracleCache(config.cache_path) : OracleCache{};
+
+    // 大きい問題例から先に片付けるよう、ファイルサイズの降順に並べてから各スレッドのキューに順に配る。
+    Array<size_t> order(all_cases.size());
+    Array<int64> file_sizes(all_cases.size());
+    for (size_t i = 0; i < all_cases.size(); i++) {
+        order[i] = i;
+        file_sizes[i] = FileSystem::FileSize(all_cases[i]);
+    }
+    std::ranges::stable_sort(order, [&](const size_t a, const size_t b) { return file_sizes[a] > file_sizes[b]; });
+
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<size_t> cases;
+    };
+    const size_t thread_count = Clamp<size_t>((config.thread_count == 0) ? Threading::GetConcurrency() : config.thread_count, 1, Max<size_t>(all_cases.size(), 1));
+    // std::mutex はムーブできないので、要素のアドレスが変わらない std::deque に置く。
+    std::deque<WorkQueue> queues(thread_count);
+    for (size_t k = 0; k < order.size(); k++) {
+        queues[k % thread_count].cases.push_back(order[k]);
+    }
+
+    // 自分のキューの先頭から取り出し、空であれば他のキューの末尾から盗む。全て空であれば`none`を返す。
+    const auto take = [&](const size_t self) -> Optional<size_t> {
+        for (size_t d = 0; d < thread_count; d++) {
+            WorkQueue& queue = queues[(self + d) % thread_count];
+            std::lock_guard lock{ queue.mutex };
+            if (queue.cases.empty()) { continue; }
+            size_t index;
+            if (d == 0) { index = queue.cases.front(); queue.cases.pop_front(); }
+            else { index = queue.cases.back(); queue.cases.pop_back(); }
+            return index;
+        }
+        return none;
+    };
+
+    Array<TestCaseOutcome> outcomes(all_cases.size());
+    const auto worker = [&](const size_t self) {
+        while (const auto index = take(self)) {
+            outcomes[*index] = RunTestCase(all_cases[*index], epsilon, cache, config.case_timeout_seconds);
+        }
+    };
+    Array<std::thread> threads;
+    for (size_t t = 1; t < thread_count; t++) {
+        threads.emplace_back(worker, t);
+    }
+    worker(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto feature_tests = FeatureTests();
+    // 機能ごとの（合致した問題例の数, テストした問題例の数）
+    Array<std::pair<size_t, size_t>> feature_success(feature_tests.size(), { 0, 0 });
     size_t success = 0;
+    size_t out_of_core_success = 0;
+    size_t timed_out = 0;
+    size_t cache_hits = 0;
+    OracleCache updated_cache = cache;
     TextWriter logger{U"fulltest.log"};
-    for (const FilePath& path : all_cases) {
-        const Array<Vec2> input = GetInputFromFile(path);
+    for (size_t i = 0; i < all_cases.size(); i++) {
+        const FilePath& path = all_cases[i];
         const String casename = FileSystem::FileName(path);
-        
-        TestCaseResult result = TestSmallestEnclosing(input, epsilon);
+
+        const auto& [result, out_of_core_succeeded, feature_succeeded, oracle_key, oracle_computed] = outcomes[i];
         test_results.push_back(result);
+        if (result.input_error) {
+            Console << U"\n[{}] \e[43m\e[37m[WA]\e[0m (unreadable input)"_fmt(casename);
+            logger << U"\n[{}] [WA]"_fmt(casename);
+            logger << U"\tinput error: the file could not be read (bad checksum, truncated or malformed)";
+            continue;
+        }
+        const bool cache_hit = cache.contains(oracle_key);
+        if (oracle_computed) { updated_cache[oracle_key] = OracleResult{ result.expected, result.oracles_agreed }; }
+        if (cache_hit) { cache_hits++; }
+        if (result.timed_out) {
+            timed_out++;
+            Console << U"\n[{}] \e[41m\e[37m[TLE]\e[0m"_fmt(casename);
+            logger << U"\n[{}] [TLE]"_fmt(casename);
+            logger << U"\ttime: > {:.3f}s"_fmt(config.case_timeout_seconds);
+            if (oracle_computed or cache_hit) { logger << U"\texpected: (center, r) = ({}, {})"_fmt(result.expected.center, result.expected.r); }
+            else { logger << U"\texpected: (timed out while computing the oracle)"; }
+            continue;
+        }
         const String judge_state = result.succeeded ? U"[AC]" : U"[WA]";
         const String judge_state_cmd = result.succeeded ? U"\e[42m\e[37m[AC]\e[0m" : U"\e[43m\e[37m[WA]\e[0m";
         if (result.succeeded) { success++; }
+        if (out_of_core_succeeded) { out_of_core_success++; }
         
         Console << U"\n[{}] {}"_fmt(casename, judge_state_cmd);
         logger << U"\n[{}] {}"_fmt(casename, judge_state);
         logger << U"\ttime: {:.9f}s"_fmt(result.process_time);
         logger << U"\texpected: (center, r) = ({}, {})"_fmt(result.expected.center, result.expected.r);
+        if (not result.oracles_agreed) { logger << U"\toracle mismatch: the expected value disagrees with SmallestEnclosingCircleNaive"; }
         logger << U"\tactual:   (center, r) = ({}, {})"_fmt(result.actual.center, result.actual.r);
+        for (size_t k = 0; k < feature_succeeded.size(); k++) {
+            if (not feature_succeeded[k]) {
+                logger << U"\t{}: (skipped: N > {})"_fmt(feature_tests[k].name, FEATURE_TEST_LIMIT);
+                continue;
+            }
+            logger << U"\t{}: {}"_fmt(feature_tests[k].name, *feature_succeeded[k] ? U"[AC]" : U"[WA]");
+            if (*feature_succeeded[k]) { feature_success[k].first++; }
+            feature_success[k].second++;
+        }
+        logger << U"\tout-of-core: {}"_fmt(IsPointFile(path) ? (out_of_core_succeeded ? U"[AC]" : U"[WA]") : U"(text input)");
+        logger << U"\tstats:    seed = {}, rebuilds (outer, middle, inner) = ({}, {}, {}), contains tests = {}, shuffle: {:.9f}s"_fmt(
+            result.seed, result.stats.outerRebuilds, result.stats.middleRebuilds, result.stats.innerRebuilds,
+            result.stats.containsTests, result.stats.shuffleSeconds);
     }
     logger << U"[AC] x {} / {}"_fmt(success, all_cases.size());
+    for (size_t k = 0; k < feature_tests.size(); k++) {
+        logger << U"[{} AC] x {} / {}"_fmt(feature_tests[k].name, feature_success[k].first, feature_success[k].second);
+    }
+    logger << U"[out-of-core AC] x {} / {}"_fmt(out_of_core_success, all_cases.size());
+    logger << U"[TLE] x {} / {}"_fmt(timed_out, all_cases.size());
     logger << U"result: {}"_fmt((success == all_cases.size()) ? U"[AC]" : U"[WA]");
 
     Console << U"\n";
     Console << U"[AC] x {} / {}"_fmt(success, all_cases.size());
+    for (size_t k = 0; k < feature_tests.size(); k++) {
+        Console << U"[{} AC] x {} / {}"_fmt(feature_tests[k].name, feature_success[k].first, feature_success[k].second);
+    }
+    Console << U"[out-of-core AC] x {} / {}"_fmt(out_of_core_success, all_cases.size());
+    Console << U"[TLE] x {} / {}"_fmt(timed_out, all_cases.size());
+    Console << U"oracle cache: {} hit(s) / {}"_fmt(cache_hits, all_cases.size());
     Console << U"result: {}"_fmt((success == all_cases.size()) ? U"\e[42m\e[37m[AC]\e[0m" : U"\e[43m\e[37m[WA]\e[0m");
     Console << U"\n";
+
+    if (config.use_cache and (not SaveOracleCache(config.cache_path, updated_cache))) {
+        Console << U"failed to write {}"_fmt(config.cache_path);
+    }
+}
+
+/**
+ * @brief ランダムに生成した3次元の点群`count`個について、`SmallestEnclosingSphere`の出力を`SmallestEnclosingSphereNaive`と突き合わせ、
+ * 合致した個数を`fulltest.log`の末尾とコンソールに出力する。合致した場合に限り`true`を返す。
+ * 点数は1〜`SPHERE_NAIVE_LIMIT`、4割の点群は同一平面上・同一直線上・重複点を含む退化した配置にする。
+ */
+bool TestRandomSpheres(const size_t count, const double epsilon, const uint64 seed = 0) {
+    DefaultRNG rng;
+    rng.seed(seed);
+    size_t success = 0;
+    TextWriter logger{U"fulltest.log", OpenMode::Append};
+    for (size_t i = 0; i < count; i++) {
+        const size_t n = Random<size_t>(1, SPHERE_NAIVE_LIMIT, rng);
+        Array<Vec3> points = GeneratePoints3D(n, rng);
+        switch (i % 5) {
+            case 0: for (auto& p : points) { p.z = 0; } break;
+            case 1: for (auto& p : points) { p = Vec3{ p.x, p.x * 2, p.x * -3 }; } break;
+            case 2: for (size_t k = 1; k < n; k += 2) { points[k] = points[k - 1]; } break;
+            default: break;
+        }
+        const Sphere expected = SmallestEnclosingSphereNaive(points, epsilon);
+        const Sphere actual = SmallestEnclosingSphere(points, epsilon, rng);
+        if (CircleMatches(expected, actual, epsilon)) { success++; }
+        else {
+            logger << U"[sphere-{}] [WA] N = {}, expected: (center, r) = ({}, {}), actual: (center, r) = ({}, {})"_fmt(
+                i, n, expected.center, expected.r, actual.center, actual.r);
+        }
+    }
+    logger << U"[random sphere AC] x {} / {}"_fmt(success, count);
+    Console << U"[random sphere AC] x {} / {}"_fmt(success, count);
+    return (success == count);
+}
+
+/**
+ * @brief ランダムに生成した点群`cluster_count`個を1つのバッファに連結し、`SmallestEnclosingCircles`をスレッド数1と複数で実行して、
+ * 全ての点群で結果がビット単位で一致するか（スレッド数によらないか）と、各点群の`SmallestEnclosingCircleFarthestPoint`と合致するかを確かめる。
+ * 結果を`fulltest.log`の末尾とコンソールに出力し、全て合致した場合に限り`true`を返す。
+ */
+bool TestBatchCircles(const size_t cluster_count, const double epsilon, const uint64 seed = 0) {
+    DefaultRNG rng;
+    rng.seed(seed);
+    Array<Vec2> points;
+    Array<size_t> offsets = { 0 };
+    for (size_t i = 0; i < cluster_count; i++) {
+        // 4点以下の点群は乱数を使わないので、シャッフルされる大きさの点群を多めに混ぜる。
+        points.append(GeneratePoints(Random<int32_t>(1, 128, rng), rng, Vec2{ 400, 300 }));
+        offsets << points.size();
+    }
+
+    Array<Circle> single;
+    SmallestEnclosingCircles(points, offsets, single, epsilon, 1);
+    TextWriter logger{U"fulltest.log", OpenMode::Append};
+    size_t success = 0;
+    size_t total = 0;
+    for (const size_t thread_count : { 2, 3, 8 }) {
+        Array<Circle> multi;
+        SmallestEnclosingCircles(points, offsets, multi, epsilon, thread_count);
+        total++;
+        const bool identical = (multi.size() == single.size())
+            and std::ranges::equal(multi, single, [](const Circle& a, const Circle& b) { return (a.center == b.center) and (a.r == b.r); });
+        if (identical) { success++; }
+        else { logger << U"[batch] [WA] results with {} threads differ from those with 1 thread"_fmt(thread_count); }
+    }
+    for (size_t i = 0; i < cluster_count; i++) {
+        const Array<Vec2> cluster(points.begin() + offsets[i], points.begin() + offsets[i + 1]);
+        const Circle expected = SmallestEnclosingCircleFarthestPoint(cluster, epsilon);
+        total++;
+        if (CircleMatches(expected, single[i], epsilon)) { success++; }
+        else {
+            logger << U"[batch-{}] [WA] N = {}, expected: (center, r) = ({}, {}), actual: (center, r) = ({}, {})"_fmt(
+                i, cluster.size(), expected.center, expected.r, single[i].center, single[i].r);
+        }
+    }
+    logger << U"[batch AC] x {} / {}"_fmt(success, total);
+    Console << U"[batch AC] x {} / {}"_fmt(success, total);
+    return (success == total);
+}
+
+/**
+ * @brief ランダムに生成した点群を`WritePointFile`で一時ファイル`filepath`に書き出し、小さな塊・小さな作業用の点群で`SmallestEnclosingCircleOutOfCore`を
+ * 先読みあり・なしの両方で実行して、メモリ上で解いた`SmallestEnclosingCircle`の出力と合致するか（先読みの有無で結果が変わらないか）を確かめる。
+ * `FullTest`の既定の流れではテキスト形式の入力しか使わず、`SmallestEnclosingCircleOutOfCore`と`PointFileChunkReader`を通らないので、ここで別に確かめる。
+ * 結果を`fulltest.log`の末尾とコンソールに出力し、全て合致した場合に限り`true`を返す。一時ファイルは最後に削除する。
+ */
+bool TestOutOfCore(const double epsilon, const uint64 seed = 0, const FilePath& filepath = U"fulltest-out-of-core.bin") {
+    DefaultRNG rng;
+    rng.seed(seed);
+    const Vec2 center{ 400, 300 };
+    // 塊の大きさ（1000点）より小さい点群・ちょうど割り切れる点群・端数のある点群と、ほぼ全ての点が凸包上にあって作業用の点群が上限に達しやすい点群。
+    const Array<std::pair<String, Array<Vec2>>> instances = {
+        { U"normal-500", GeneratePoints(500, rng, center) },
+        { U"normal-4000", GeneratePoints(4'000, rng, center) },
+        { U"normal-100003", GeneratePoints(100'003, rng, center) },
+        { U"near-cocircular-20000", GenerateNearCocircular(20'000, rng, center, 150, 1e-3) },
+    };
+
+    TextWriter logger{U"fulltest.log", OpenMode::Append};
+    size_t success = 0;
+    size_t total = 0;
+    for (const auto& [name, points] : instances) {
+        const Circle expected = SmallestEnclosingCircle(points, epsilon);
+        if (not WritePointFile(filepath, points)) {
+            logger << U"[out-of-core-{}] [WA] failed to write {}"_fmt(name, filepath);
+            total += 2;
+            continue;
+        }
+        Optional<Circle> previous;
+        for (const bool read_ahead : { false, true }) {
+            total++;
+            const auto actual = SmallestEnclosingCircleOutOfCore(filepath, OutOfCoreConfig{
+                .chunk_points = 1000, .working_capacity = 2048, .read_ahead = read_ahead, .sample_size = 256, .epsilon = epsilon, .seed = seed });
+            // 先読みの有無では読む順序も標本も変わらないので、結果はビット単位で一致するはず。
+            const bool succeeded = actual and actual->converged and CircleMatches(expected, actual->circle, epsilon)
+                and ((not previous) or ((previous->center == actual->circle.center) and (previous->r == actual->circle.r)));
+            if (succeeded) { success++; }
+            else {
+                logger << U"[out-of-core-{}] [WA] read_ahead = {}, expected: (center, r) = ({}, {}), actual: {}"_fmt(
+                    name, read_ahead, expected.center, expected.r,
+                    actual ? U"(center, r) = ({}, {}), converged = {}"_fmt(actual->circle.center, actual->circle.r, actual->converged) : U"(unreadable)");
+            }
+            if (actual) { previous = actual->circle; }
+        }
+    }
+    FileSystem::Remove(filepath);
+    logger << U"[out-of-core file AC] x {} / {}"_fmt(success, total);
+    Console << U"[out-of-core file AC] x {} / {}"_fmt(success, total);
+    return (success == total);
 }
 
 /**
@@ -157,27 +932,34 @@ void TestAllCases(
  * 
  * 1. `App/input-auto`, `App/input-handmade`に格納されている入力値を読み取り、
  * 
- * 2. それをテスト対象`SmallestEnclosingCircle`, 期待値を出力するナイーブな実装`SmallesetEnclosingCircleNaive`に入力して、
+ * 2. それをテスト対象`SmallestEnclosingCircle`, 期待値を出力する実装`SmallestEnclosingCircleFarthestPoint`に入力して、
+ *    （点数が少なければ、ナイーブな実装`SmallesetEnclosingCircleNaive`の出力とも期待値を突き合わせて、）
  * 
  * 3. 最後にそれらの出力値が合致するかを判定する。
  * 
+ * 問題例は`config.thread_count`個のスレッドで並列に解き、期待値は`config.cache_path`にキャッシュする（詳しくは`TestAllCases`）。
+ * 
  * テストが終わった後はビジュアライザが起動し、どのように出力されたかを目視で確認できる。
  * 
  * @param EPSILON 出力値の相等性を判定する、かつ、アルゴリズムの動作に使われる許容誤差。
  * 相対誤差・絶対誤差のいずれかで許容誤差内に誤差がおさまっていれば相等性を認める。
  */
-void FullTest(const double EPSILON = 1e-8) {
+void FullTest(const double EPSILON = 1e-8, const FullTestConfig& config = {}) {
     // テスト処理
     Logger << U"[FullTest at {}]"_fmt(DateTime::Now());
     Array<FilePath> all_cases = ReadAllTestCases();
     Array<TestCaseResult> test_results;
-    TestAllCases(all_cases, test_results, EPSILON);
+    TestAllCases(all_cases, test_results, EPSILON, config);
+    TestRandomSpheres(1000, EPSILON);
+    TestBatchCircles(4000, EPSILON);
+    TestOutOfCore(EPSILON);
     
     // テスト結果のビジュアライザ
     // ジャッジ状態を含めたテストケース名の列挙
     Array<FilePath> all_cases_title(all_cases.size());
     for (size_t i = 0; i < all_cases.size(); i++) {
-        all_cases_title[i] = U"[{}] {}"_fmt(test_results[i].succeeded ? U"AC" : U"WA", FileSystem::FileName(all_cases[i]));
+        const StringView judge_state = test_results[i].timed_out ? U"TLE" : (test_results[i].succeeded ? U"AC" : U"WA");
+        all_cases_title[i] = U"[{}] {}"_fmt(judge_state, FileSystem::FileName(all_cases[i]));
     }
     // 問題例をあらわす点群を格納する配列
     Array<Vec2> current_instance;
@@ -196,7 +978,7 @@ void FullTest(const double EPSILON = 1e-8) {
         if (case_list.selectedItemIndex and current_selection != case_list.selectedItemIndex) {
             // 問題例の計算
             current_selection = case_list.selectedItemIndex;
-            current_instance = GetInputFromFile(all_cases[*current_selection]);
+            current_instance = GetInputFromFile(all_cases[*current_selection]).value_or(Array<Vec2>{});
             testcase_result = test_results[*current_selection];
             viewport_affine = RenderedAreaMat(current_instance, view_area, point_scale);
         }
@@ -212,7 +994,7 @@ void FullTest(const double EPSILON = 1e-8) {
 /**
  * @brief ランダムに問題例を1秒間ずつ生成し、
  * その問題例に対するテスト対象`SmallestEnclosingCircle`と
- * 期待値（`SmallesetEnclosingCircleNaive`）の比較を
+ * 期待値（`SmallestEnclosingCircleFarthestPoint`）の比較を
  * ビジュアライズする。
  */
 void VisualRandomTest()
@@ -274,15 +1056,13 @@ void VisualRandomTest()
 //--------------------------------------------------------------
 
 
-Array<Vec2> GetInputFromFile(const FilePath& filepath) {
-    std::ifstream fin{filepath.toUTF8()};
-    assert(fin);
-    int32_t N; fin >> N;
-    Array<Vec2> result(N);
-    for (int32_t i = 0; i < N; i++) {
-        fin >> result[i].x >> result[i].y;
+Optional<Array<Vec2>> GetInputFromFile(const FilePath& filepath) {
+    if (IsPointFile(filepath)) {
+        const MappedPointFile file{filepath};
+        if (not file.verifyChecksum()) { return none; }
+        return Array<Vec2>(file.points().begin(), file.points().end());
     }
-    return result;
+    return ReadTextPointFile(filepath);
 }
 Array<FilePath> ReadAllTestCases() {
     const Array<FilePath> cases_handmade    = FileSystem::DirectoryContents(U"input-handmade");
@@ -291,7 +1071,27 @@ Array<FilePath> ReadAllTestCases() {
     std::ranges::copy(cases_handmade, std::back_inserter(all_cases));
     std::ranges::copy(cases_auto, std::back_inserter(all_cases));
     std::ranges::sort(all_cases);
-    return all_cases;
+    // 両方の形式がある場合は、読み込みの速いバイナリ形式を使う。
+    // ただし`GenerateLargeInputs`はテキスト形式だけを書き直すので、テキスト形式より古いバイナリ形式は使わない。
+    const auto binary_is_current = [](const FilePath& binary_path, const FilePath& text_path) {
+        const auto binary_time = FileSystem::WriteTime(binary_path);
+        const auto text_time = FileSystem::WriteTime(text_path);
+        return binary_time and text_time and (not (*binary_time < *text_time));
+    };
+    return all_cases.filter([&](const FilePath& path) {
+        const String extension = FileSystem::Extension(path);
+        const FilePath stem = path.substr(0, path.size() - extension.size());
+        if (extension == U"bin") {
+            const FilePath text_path = stem + U"txt";
+            return (not std::ranges::binary_search(all_cases, text_path)) or binary_is_current(path, text_path);
+        }
+        if (extension != U"txt") { return false; }
+        const FilePath binary_path = stem + U"bin";
+        if (not std::ranges::binary_search(all_cases, binary_path)) { return true; }
+        if (binary_is_current(binary_path, path)) { return false; }
+        Console << U"ignoring {}: older than {} (run ConvertInputs again to refresh it)"_fmt(binary_path, path);
+        return true;
+    });
 }
 
 Mat3x2 RenderedAreaMat(const Array<Vec2>& current_instance, const RectF& view_area, double& point_scale) {
@@ -344,4 +1144,17 @@ bool EqualRelativeErr(const double expected, const double actual, const double e
     const double abs_err = AbsDiff(expected, actual);
     if (expected == 0) { return abs_err < err; }
     return abs_err/expected < err or abs_err < err;
+}
+
+bool CircleMatches(const Circle& expected, const Circle& actual, const double err) {
+    return EqualRelativeErr(expected.center.x, actual.center.x, err)
+        and EqualRelativeErr(expected.center.y, actual.center.y, err)
+        and EqualRelativeErr(expected.r, actual.r, err);
+}
+
+bool CircleMatches(const Sphere& expected, const Sphere& actual, const double err) {
+    return EqualRelativeErr(expected.center.x, actual.center.x, err)
+        and EqualRelativeErr(expected.center.y, actual.center.y, err)
+        and EqualRelativeErr(expected.center.z, actual.center.z, err)
+        and EqualRelativeErr(expected.r, actual.r, err);
 }
\ No newline at end of file